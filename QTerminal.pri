@@ -0,0 +1,57 @@
+INCLUDEPATH += $$PWD/include $$PWD/include/KGL/Widgets
+
+SOURCES += \
+    $$PWD/src/Core/QAnsiParser.cpp \
+    $$PWD/src/Core/QFloatFormatter.cpp \
+    $$PWD/src/Core/QNumberFormatter.cpp \
+    $$PWD/src/Core/QNumberParser.cpp \
+    $$PWD/src/Core/QTerminalBuffer.cpp \
+    $$PWD/src/Core/QTerminalHighlighter.cpp \
+    $$PWD/src/Core/QTerminalLog.cpp \
+    $$PWD/src/Core/QTerminalMappedFile.cpp \
+    $$PWD/src/Core/QTerminalProcess.cpp \
+    $$PWD/src/Core/QTerminalQueue.cpp \
+    $$PWD/src/Core/QTerminalRecorder.cpp \
+    $$PWD/src/Core/QTerminalSearch.cpp \
+    $$PWD/src/Core/QTerminalStats.cpp \
+    $$PWD/src/Core/QTerminalTrace.cpp \
+    $$PWD/src/Core/QUtf8Decoder.cpp \
+    $$PWD/src/Widgets/QTerminalSearchBar.cpp \
+    $$PWD/src/Widgets/QTerminalView.cpp \
+    $$PWD/src/Dialogs/QTerminal.cpp \
+    $$PWD/src/Design/QTerminalDesign.cpp \
+    $$PWD/src/Dialogs/QFormatEditor.cpp
+
+HEADERS += \
+    $$PWD/include/KGL/Core/QAnsiParser.hpp \
+    $$PWD/include/KGL/Core/QFloatFormatter.hpp \
+    $$PWD/include/KGL/Core/QFormatString.hpp \
+    $$PWD/include/KGL/Core/QNumberFormatter.hpp \
+    $$PWD/include/KGL/Core/QNumberParser.hpp \
+    $$PWD/include/KGL/Core/QTerminalBuffer.hpp \
+    $$PWD/include/KGL/Core/QTerminalHighlighter.hpp \
+    $$PWD/include/KGL/Core/QTerminalLineSource.hpp \
+    $$PWD/include/KGL/Core/QTerminalLog.hpp \
+    $$PWD/include/KGL/Core/QTerminalMappedFile.hpp \
+    $$PWD/include/KGL/Core/QTerminalProcess.hpp \
+    $$PWD/include/KGL/Core/QTerminalQueue.hpp \
+    $$PWD/include/KGL/Core/QTerminalRecorder.hpp \
+    $$PWD/include/KGL/Core/QTerminalSearch.hpp \
+    $$PWD/include/KGL/Core/QTerminalStats.hpp \
+    $$PWD/include/KGL/Core/QTerminalTrace.hpp \
+    $$PWD/include/KGL/Core/QUtf8Decoder.hpp \
+    $$PWD/include/KGL/Widgets/QTerminalSearchBar.hpp \
+    $$PWD/include/KGL/Widgets/QTerminalView.hpp \
+    $$PWD/include/KGL/Dialogs/QTerminal.hpp \
+    $$PWD/include/KGL/KGLConfig.hpp \
+    $$PWD/include/KGL/Design/QTerminalDesign.hpp \
+    $$PWD/include/KGL/Dialogs/QTerminalEnums.hpp \
+    $$PWD/include/KGL/Dialogs/QFormatEditor.hpp
+
+FORMS += \
+    $$PWD/res/QFormatEditor.ui
+
+RESOURCES += \
+    $$PWD/res/gui.qrc
+
+unix:!macx: LIBS += -lutil
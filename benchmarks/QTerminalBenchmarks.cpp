@@ -0,0 +1,598 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+//
+//  Included headers
+//
+#include <KGL/Dialogs/QTerminal.hpp>
+#include <KGL/Core/QFloatFormatter.hpp>
+#include <KGL/Core/QTerminalBuffer.hpp>
+#include <KGL/Widgets/QTerminalView.hpp>
+#include <QApplication>
+#include <QTextEdit>
+#include <QtTest>
+#include <thread>
+#include <vector>
+
+
+///
+///  Benchmarks for the output, input and scrollback paths of QTerminal.
+///  Runs headless on the 'offscreen' platform unless QT_QPA_PLATFORM is
+///  set. Results can be written in a machine-readable form through the
+///  usual QtTest options, e.g.
+///
+///      QTerminalBenchmarks -o results.xml,xml -o -,txt
+///      QTerminalBenchmarks -csv
+///
+///  Each data row states its own parameters in the row name so that the
+///  results of two runs can be compared line by line.
+///
+Q_DECLARE_METATYPE(kgl::RenderBackend)
+Q_DECLARE_METATYPE(kgl::NumberFormat)
+
+namespace
+{
+    /// Amount of characters written per benchmark iteration.
+    const int BytesPerIteration = 64 * 1024;
+
+    ///
+    ///  @fn      backendName
+    ///  @brief   Names the backend for a data row.
+    ///  @param   backend Render backend
+    ///  @returns "document" or "grid".
+    ///
+    const char *backendName(kgl::RenderBackend backend) {
+        return (backend == kgl::RenderBackend::Grid) ? "grid" : "document";
+    }
+}
+
+
+class QTerminalBenchmarks : public QObject {
+    Q_OBJECT
+private slots:
+
+    void init();
+    void cleanup();
+
+    void writeString_data();
+    void writeString();
+    void writeLine_data();
+    void writeLine();
+    void setCurrentState_data();
+    void setCurrentState();
+    void writeUInt64_data();
+    void writeUInt64();
+    void writeUInt32s();
+    void writeDouble();
+    void formatDouble_data();
+    void formatDouble();
+    void post_data();
+    void post();
+    void readLine_data();
+    void readLine();
+    void readInt64();
+    void scrollback_data();
+    void scrollback();
+    void bufferAppend_data();
+    void bufferAppend();
+
+private:
+
+    void createTerminal(kgl::RenderBackend backend);
+    QWidget *inputWidget() const;
+    void typeLine(const QString &line);
+
+    // Private class members
+    kgl::QTerminal *m_Terminal;
+};
+
+
+///
+///  @fn        init
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::init() {
+    m_Terminal = NULL;
+}
+
+///
+///  @fn        cleanup
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::cleanup() {
+    delete m_Terminal;
+    m_Terminal = NULL;
+}
+
+///
+///  @fn        createTerminal
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::createTerminal(kgl::RenderBackend backend) {
+    m_Terminal = new kgl::QTerminal(NULL);
+    m_Terminal->setRenderBackend(backend);
+    m_Terminal->resize(800, 600);
+    m_Terminal->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_Terminal));
+}
+
+///
+///  @fn        inputWidget : const
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+QWidget *QTerminalBenchmarks::inputWidget() const {
+    if (m_Terminal->renderBackend() == kgl::RenderBackend::Grid) {
+        return m_Terminal->findChild<kgl::QTerminalView *>();
+    } else {
+        return m_Terminal->findChild<QTextEdit *>("input");
+    }
+}
+
+///
+///  @fn        typeLine
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::typeLine(const QString &line) {
+    QWidget *input = inputWidget();
+    QTest::keyClicks(input, line);
+    QTest::keyClick(input, Qt::Key_Return);
+
+    // Async callbacks are deferred to the next event loop iteration
+    QCoreApplication::processEvents();
+}
+
+///
+///  @fn        writeString_data
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::writeString_data() {
+    QTest::addColumn<kgl::RenderBackend>("backend");
+    QTest::addColumn<int>("fragment");
+
+    const kgl::RenderBackend backends[] = {
+        kgl::RenderBackend::Document,
+        kgl::RenderBackend::Grid
+    };
+    const int fragments[] = { 1, 16, 256, 4096 };
+    for (kgl::RenderBackend backend : backends) {
+        for (int fragment : fragments) {
+            QTest::addRow("%s/%d", backendName(backend), fragment)
+                << backend << fragment;
+        }
+    }
+}
+
+///
+///  @fn        writeString
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::writeString() {
+    QFETCH(kgl::RenderBackend, backend);
+    QFETCH(int, fragment);
+    createTerminal(backend);
+
+    // One line break every 64 characters keeps the lines realistic
+    QString text(fragment, QLatin1Char('x'));
+    for (int i = 63; i < fragment; i += 64) {
+        text[i] = QLatin1Char('\n');
+    }
+
+    const int count = BytesPerIteration / fragment;
+    QBENCHMARK {
+        for (int i = 0; i < count; i++) {
+            m_Terminal->writeString(text);
+        }
+        m_Terminal->flush();
+    }
+}
+
+///
+///  @fn        writeLine_data
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::writeLine_data() {
+    writeString_data();
+}
+
+///
+///  @fn        writeLine
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::writeLine() {
+    QFETCH(kgl::RenderBackend, backend);
+    QFETCH(int, fragment);
+    createTerminal(backend);
+
+    const QString text(fragment, QLatin1Char('x'));
+    const int count = BytesPerIteration / (fragment + 1);
+    QBENCHMARK {
+        for (int i = 0; i < count; i++) {
+            m_Terminal->writeLine(text);
+        }
+        m_Terminal->flush();
+    }
+}
+
+///
+///  @fn        setCurrentState_data
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::setCurrentState_data() {
+    QTest::addColumn<kgl::RenderBackend>("backend");
+    QTest::addColumn<bool>("write");
+
+    QTest::newRow("document/toggle") << kgl::RenderBackend::Document << false;
+    QTest::newRow("document/toggle+write") << kgl::RenderBackend::Document << true;
+    QTest::newRow("grid/toggle") << kgl::RenderBackend::Grid << false;
+    QTest::newRow("grid/toggle+write") << kgl::RenderBackend::Grid << true;
+}
+
+///
+///  @fn        setCurrentState
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::setCurrentState() {
+    QFETCH(kgl::RenderBackend, backend);
+    QFETCH(bool, write);
+    createTerminal(backend);
+
+    // Alternating states force a new run for every word
+    const QString word = QStringLiteral("word ");
+    QBENCHMARK {
+        for (int i = 0; i < 10000; i++) {
+            m_Terminal->setCurrentState((i & 1)
+                ? kgl::TextState::Error
+                : kgl::TextState::Normal, (i & 2) != 0);
+            if (write) {
+                m_Terminal->writeString(word);
+            }
+        }
+        m_Terminal->flush();
+    }
+}
+
+///
+///  @fn        writeUInt64_data
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::writeUInt64_data() {
+    QTest::addColumn<kgl::NumberFormat>("format");
+
+    QTest::newRow("decimal") << kgl::NumberFormat::Decimal;
+    QTest::newRow("hexadecimal") << kgl::NumberFormat::Hexadecimal;
+    QTest::newRow("octal") << kgl::NumberFormat::Octal;
+    QTest::newRow("binary") << kgl::NumberFormat::Binary;
+}
+
+///
+///  @fn        writeUInt64
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::writeUInt64() {
+    QFETCH(kgl::NumberFormat, format);
+    createTerminal(kgl::RenderBackend::Grid);
+
+    QBENCHMARK {
+        quint64 value = Q_UINT64_C(0x9E3779B97F4A7C15);
+        for (int i = 0; i < 10000; i++) {
+            m_Terminal->writeUInt64(value, format);
+            value = value * Q_UINT64_C(6364136223846793005) + 1;
+        }
+        m_Terminal->flush();
+    }
+}
+
+///
+///  @fn        writeUInt32s
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::writeUInt32s() {
+    createTerminal(kgl::RenderBackend::Grid);
+
+    std::vector<quint32> values(10000);
+    for (size_t i = 0; i < values.size(); i++) {
+        values[i] = quint32(i * 2654435761u);
+    }
+
+    QBENCHMARK {
+        m_Terminal->writeUInt32s(values.data(), qint32(values.size()));
+        m_Terminal->flush();
+    }
+}
+
+///
+///  @fn        writeDouble
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::writeDouble() {
+    createTerminal(kgl::RenderBackend::Grid);
+
+    QBENCHMARK {
+        double value = 1.0 / 3.0;
+        for (int i = 0; i < 10000; i++) {
+            m_Terminal->writeDouble(value);
+            value *= -1.0001;
+        }
+        m_Terminal->flush();
+    }
+}
+
+///
+///  @fn        formatDouble_data
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::formatDouble_data() {
+    QTest::addColumn<int>("path");
+
+    // The former writeDouble formatted with 'f' and 12 decimals
+    QTest::newRow("QFloatFormatter") << 0;
+    QTest::newRow("QString::number/f12") << 1;
+    QTest::newRow("QString::number/g17") << 2;
+}
+
+///
+///  @fn        formatDouble
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::formatDouble() {
+    QFETCH(int, path);
+
+    // Compares the shortest round-trip output against the former path
+    // and against Qt's own round-trip precision
+    QString out;
+    QBENCHMARK {
+        out.clear();
+        double value = 1.0 / 3.0;
+        for (int i = 0; i < 10000; i++) {
+            if (path == 1) {
+                out += QString::number(value, 'f', 12);
+            } else if (path == 2) {
+                out += QString::number(value, 'g', 17);
+            } else {
+                kgl::QFloatFormatter::append(value, kgl::FloatFormat::Shortest, 0, out);
+            }
+            value *= -1.0001;
+        }
+    }
+}
+
+///
+///  @fn        post_data
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::post_data() {
+    QTest::addColumn<int>("producers");
+
+    QTest::newRow("1") << 1;
+    QTest::newRow("4") << 4;
+    QTest::newRow("16") << 16;
+}
+
+///
+///  @fn        post
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::post() {
+    QFETCH(int, producers);
+    createTerminal(kgl::RenderBackend::Grid);
+
+    // Every iteration posts the same total amount of lines
+    const int lines = 64000 / producers;
+    const QString text = QStringLiteral("posted from a worker thread\n");
+    QBENCHMARK {
+        std::vector<std::thread> threads;
+        for (int i = 0; i < producers; i++) {
+            threads.emplace_back([this, lines, &text]() {
+                for (int j = 0; j < lines; j++) {
+                    m_Terminal->post(text);
+                }
+            });
+        }
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+
+        // Drains the queue on the GUI thread
+        QCoreApplication::sendPostedEvents();
+        m_Terminal->flush();
+    }
+}
+
+///
+///  @fn        readLine_data
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::readLine_data() {
+    QTest::addColumn<kgl::RenderBackend>("backend");
+
+    QTest::newRow("document") << kgl::RenderBackend::Document;
+    QTest::newRow("grid") << kgl::RenderBackend::Grid;
+}
+
+///
+///  @fn        readLine
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::readLine() {
+    QFETCH(kgl::RenderBackend, backend);
+    createTerminal(backend);
+
+    int received = 0;
+    QBENCHMARK {
+        m_Terminal->readLineAsync([&received](const QString &) {
+            received++;
+        });
+        typeLine(QStringLiteral("the quick brown fox"));
+    }
+    QVERIFY(received > 0);
+}
+
+///
+///  @fn        readInt64
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::readInt64() {
+    createTerminal(kgl::RenderBackend::Grid);
+
+    qint64 sum = 0;
+    QBENCHMARK {
+        m_Terminal->readInt64Async([&sum](qint64 value) {
+            sum += value;
+        });
+        typeLine(QStringLiteral("-9223372036854775807"));
+    }
+    QVERIFY(sum < 0);
+}
+
+///
+///  @fn        scrollback_data
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::scrollback_data() {
+    QTest::addColumn<kgl::RenderBackend>("backend");
+    QTest::addColumn<int>("lines");
+
+    const kgl::RenderBackend backends[] = {
+        kgl::RenderBackend::Document,
+        kgl::RenderBackend::Grid
+    };
+    const int sizes[] = { 10000, 100000, 1000000 };
+    for (kgl::RenderBackend backend : backends) {
+        for (int size : sizes) {
+            QTest::addRow("%s/%d", backendName(backend), size)
+                << backend << size;
+        }
+    }
+}
+
+///
+///  @fn        scrollback
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::scrollback() {
+    QFETCH(kgl::RenderBackend, backend);
+    QFETCH(int, lines);
+    createTerminal(backend);
+    m_Terminal->setScrollbackLines(lines);
+
+    // Fills the scrollback up to its limit outside of the measurement
+    const QString line = QStringLiteral("scrollback line with a little text");
+    QString chunk;
+    for (int i = 0; i < 1000; i++) {
+        chunk += line;
+        chunk += QLatin1Char('\n');
+    }
+    for (int i = 0; i < lines; i += 1000) {
+        m_Terminal->writeString(chunk);
+        m_Terminal->flush();
+    }
+
+    // Appending to a full scrollback also evicts the oldest lines
+    QBENCHMARK {
+        m_Terminal->writeString(chunk);
+        m_Terminal->flush();
+        m_Terminal->repaint();
+    }
+}
+
+///
+///  @fn        bufferAppend_data
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::bufferAppend_data() {
+    QTest::addColumn<int>("lines");
+
+    const int sizes[] = { 10000, 100000, 1000000 };
+    for (int size : sizes) {
+        QTest::addRow("%d", size) << size;
+    }
+}
+
+///
+///  @fn        bufferAppend
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalBenchmarks::bufferAppend() {
+    QFETCH(int, lines);
+
+    // The model alone, as used by batch jobs without any widget
+    kgl::QTerminalBuffer buffer;
+    buffer.setMaximumLines(lines);
+
+    QString chunk;
+    for (int i = 0; i < 1000; i++) {
+        chunk += QStringLiteral("scrollback line with a little text\n");
+    }
+    for (int i = 0; i < lines; i += 1000) {
+        buffer.append(chunk, kgl::TextState::Normal);
+    }
+
+    QBENCHMARK {
+        buffer.append(chunk, kgl::TextState::Normal);
+    }
+    QCOMPARE(buffer.lineCount(), qint64(lines));
+}
+
+
+///
+///  @fn        main
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+int main(int argc, char *argv[]) {
+    // Runs without a display unless a platform was asked for
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    QApplication app(argc, argv);
+    QTerminalBenchmarks benchmarks;
+    return QTest::qExec(&benchmarks, argc, argv);
+}
+
+#include "QTerminalBenchmarks.moc"
@@ -0,0 +1,150 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+#ifndef __KGL_QANSIPARSER_HPP__
+#define __KGL_QANSIPARSER_HPP__
+
+
+//
+//  Included headers
+//
+#include <KGL/KGLConfig.hpp>
+#include <KGL/Dialogs/QTerminalEnums.hpp>
+#include <QChar>
+
+
+namespace kgl {
+
+    ///
+    ///  @file      QAnsiParser.hpp
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///  @class     QAnsiParser
+    ///  @brief     Streaming interpreter for ANSI/VT100 SGR sequences.
+    ///
+    ///  Text is scanned for ESC characters several characters at a time;
+    ///  everything in between is handed to the handler as one span that
+    ///  points into the input, so plain text is never copied. Escape
+    ///  sequences may be split across calls. Only SGR ('m') sequences
+    ///  change the attributes, all other sequences are swallowed.
+    ///
+    class KGL_API QAnsiParser {
+    public:
+
+        ///
+        ///  @struct  Attributes
+        ///  @brief   Graphic rendition selected by SGR sequences.
+        ///
+        ///  Red, green, yellow and the default color map onto the
+        ///  Error, Success, Warning and Normal states, so they follow
+        ///  the terminal design. All other colors are given as ARGB.
+        ///
+        struct Attributes {
+            TextState state;
+            quint32 foreground;     ///< 0xAARRGGBB, 0 to use the state color
+            quint32 background;     ///< 0xAARRGGBB, 0 for no background
+            bool bold;
+            bool underline;
+            bool inverse;           ///< Displayed as highlighted text
+        };
+
+        ///
+        ///  @class   Handler
+        ///  @brief   Receives the output of the parser.
+        ///
+        class Handler {
+        public:
+            virtual ~Handler() { }
+            virtual void text(const QChar *data, qint32 length) = 0;
+            virtual void attributes(const Attributes &attributes) = 0;
+        };
+
+        ///
+        ///  @fn    Default constructor
+        ///  @brief Initializes a new instance of QAnsiParser.
+        ///
+        QAnsiParser();
+
+
+        ///
+        ///  @fn      attributes : const
+        ///  @brief   Retrieves the attributes selected so far.
+        ///  @returns the current attributes.
+        ///
+        const Attributes &attributes() const;
+
+        ///
+        ///  @fn    reset
+        ///  @brief Resets the attributes and drops a partial sequence.
+        ///
+        void reset();
+
+        ///
+        ///  @fn    parse
+        ///  @brief Interprets the given text.
+        ///  @param data Text to interpret
+        ///  @param length Amount of characters
+        ///  @param handler Receives text spans and attribute changes
+        ///
+        void parse(const QChar *data, qint32 length, Handler &handler);
+
+
+        ///
+        ///  @fn      findEscape
+        ///  @brief   Finds the first ESC character.
+        ///  @param   begin Start of the text
+        ///  @param   end End of the text
+        ///  @returns a pointer to the ESC character or 'end'.
+        ///
+        static const QChar *findEscape(const QChar *begin, const QChar *end);
+
+
+    private:
+
+        void selectGraphicRendition(Handler &handler);
+        static quint32 paletteColor(qint32 index);
+
+        //
+        // Position within an escape sequence
+        //
+        enum class State {
+            Ground,
+            Escape,
+            Csi,
+            Osc,
+            OscEscape
+        };
+
+        //
+        // Private class members
+        //
+        Attributes m_Attributes;
+        State m_State;
+        qint32 m_Params[16];
+        qint32 m_ParamCount;
+        bool m_IsPrivate;
+    };
+}
+
+
+#endif  // __KGL_QANSIPARSER_HPP__
@@ -0,0 +1,117 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+#ifndef __KGL_QFLOATFORMATTER_HPP__
+#define __KGL_QFLOATFORMATTER_HPP__
+
+
+//
+//  Included headers
+//
+#include <KGL/KGLConfig.hpp>
+#include <KGL/Dialogs/QTerminalEnums.hpp>
+#include <QString>
+
+
+namespace kgl {
+
+    ///
+    ///  @file      QFloatFormatter.hpp
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///  @class     QFloatFormatter
+    ///  @brief     Formats floating-point numbers without allocating.
+    ///
+    ///  The shortest format uses Grisu2, which yields the fewest digits
+    ///  that still read back as the exact same value in nearly all cases
+    ///  and a round-tripping representation in all others. Fixed and
+    ///  scientific formats round to the given precision.
+    ///
+    class KGL_API QFloatFormatter {
+    public:
+
+        ///
+        ///  @var   MaximumLength
+        ///  @brief Maximum amount of characters one number formats to.
+        ///
+        static const qint32 MaximumLength = 400;
+
+        ///
+        ///  @var   MaximumPrecision
+        ///  @brief Precisions above this value are clamped.
+        ///
+        static const qint32 MaximumPrecision = 60;
+
+
+        ///
+        ///  @fn      format
+        ///  @brief   Formats a double.
+        ///  @param   value Number to format
+        ///  @param   f Shortest, fixed or scientific notation
+        ///  @param   precision Digits after the decimal point; ignored
+        ///           by the shortest format
+        ///  @param   out Receives at most MaximumLength characters
+        ///  @returns the amount of characters written.
+        ///  @note    The shortest format switches to scientific notation
+        ///           below 1e-6 and from 1e21 onwards.
+        ///
+        static qint32 format(double value, FloatFormat f, qint32 precision, QChar *out);
+
+        ///
+        ///  @fn      format
+        ///  @brief   Formats a float.
+        ///  @param   value Number to format
+        ///  @param   f Shortest, fixed or scientific notation
+        ///  @param   precision Digits after the decimal point; ignored
+        ///           by the shortest format
+        ///  @param   out Receives at most MaximumLength characters
+        ///  @returns the amount of characters written.
+        ///  @note    The shortest format picks the fewest digits that
+        ///           identify the float, not the double it widens to.
+        ///
+        static qint32 format(float value, FloatFormat f, qint32 precision, QChar *out);
+
+        ///
+        ///  @fn    append
+        ///  @brief Formats a double and appends it to 'out'.
+        ///  @param value Number to format
+        ///  @param f Shortest, fixed or scientific notation
+        ///  @param precision Digits after the decimal point
+        ///  @param out String to append to
+        ///
+        static void append(double value, FloatFormat f, qint32 precision, QString &out);
+
+        ///
+        ///  @fn    append
+        ///  @brief Formats a float and appends it to 'out'.
+        ///  @param value Number to format
+        ///  @param f Shortest, fixed or scientific notation
+        ///  @param precision Digits after the decimal point
+        ///  @param out String to append to
+        ///
+        static void append(float value, FloatFormat f, qint32 precision, QString &out);
+    };
+}
+
+
+#endif  // __KGL_QFLOATFORMATTER_HPP__
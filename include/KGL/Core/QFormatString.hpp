@@ -0,0 +1,351 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+#ifndef __KGL_QFORMATSTRING_HPP__
+#define __KGL_QFORMATSTRING_HPP__
+
+
+//
+//  Included headers
+//
+#include <KGL/KGLConfig.hpp>
+#include <QByteArray>
+#include <QString>
+#include <type_traits>
+
+
+namespace kgl {
+
+    ///
+    ///  @file      QFormatString.hpp
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///  @class     QFormatString
+    ///  @brief     Parses and validates format strings, also at compile time.
+    ///
+    ///  Placeholders are written as {} or {:spec}, where spec is
+    ///  [0][width][.precision][type]. A leading 0 pads numbers with
+    ///  zeroes instead of blanks. Types are d, x, o and b for integers,
+    ///  g (shortest), f and e for floating-point numbers, s for strings
+    ///  and booleans and c for characters. Precision applies to f and e.
+    ///
+    ///  Style tags switch the text state for the rest of the line:
+    ///  {!normal}, {!error}, {!success} and {!warning}; a trailing '+'
+    ///  highlights, as in {!error+}, and {!} restores the initial style.
+    ///  {{ and }} yield literal braces.
+    ///
+    class KGL_API QFormatString {
+    public:
+
+        ///
+        ///  @enum  Category
+        ///  @brief Kinds of arguments a placeholder may receive.
+        ///
+        enum Category {
+            Integer,
+            Float,
+            String,
+            Char,
+            Bool
+        };
+
+        ///
+        ///  @struct Spec
+        ///  @brief  Parsed contents of one placeholder.
+        ///
+        struct Spec {
+            int width;
+            int precision;
+            char type;
+            bool zero;
+        };
+
+        ///
+        ///  @struct Tag
+        ///  @brief  Parsed contents of one style tag.
+        ///
+        struct Tag {
+            int state;          ///< TextState as integer, -1 to restore
+            bool highlight;
+        };
+
+
+        ///
+        ///  @fn      parseSpec
+        ///  @brief   Parses a placeholder.
+        ///  @param   f Format string
+        ///  @param   i Index behind the opening brace
+        ///  @param   spec Receives the placeholder
+        ///  @returns the index behind the closing brace, -1 if malformed.
+        ///
+        static constexpr int parseSpec(const char *f, int i, Spec &spec) {
+            spec.width = 0;
+            spec.precision = -1;
+            spec.type = '\0';
+            spec.zero = false;
+
+            if (f[i] == ':') {
+                ++i;
+                if (f[i] == '0') {
+                    spec.zero = true;
+                    ++i;
+                }
+                while (f[i] >= '0' && f[i] <= '9') {
+                    spec.width = spec.width * 10 + (f[i++] - '0');
+                    if (spec.width > 128)
+                        return -1;
+                }
+                if (f[i] == '.') {
+                    spec.precision = 0;
+                    if (f[++i] < '0' || f[i] > '9')
+                        return -1;
+                    while (f[i] >= '0' && f[i] <= '9') {
+                        spec.precision = spec.precision * 10 + (f[i++] - '0');
+                        if (spec.precision > 60)
+                            return -1;
+                    }
+                }
+                if (isType(f[i]))
+                    spec.type = f[i++];
+            }
+
+            return f[i] == '}' ? i + 1 : -1;
+        }
+
+        ///
+        ///  @fn      parseTag
+        ///  @brief   Parses a style tag.
+        ///  @param   f Format string
+        ///  @param   i Index behind the exclamation mark
+        ///  @param   tag Receives the style
+        ///  @returns the index behind the closing brace, -1 if malformed.
+        ///
+        static constexpr int parseTag(const char *f, int i, Tag &tag) {
+            const char *names[] = { "normal", "error", "success", "warning" };
+            tag.state = -1;
+            tag.highlight = false;
+
+            for (int s = 0; s < 4 && tag.state < 0; ++s) {
+                int n = 0;
+                while (names[s][n] != '\0' && f[i + n] == names[s][n])
+                    ++n;
+                if (names[s][n] == '\0') {
+                    tag.state = s;
+                    i += n;
+                }
+            }
+            if (tag.state >= 0 && f[i] == '+') {
+                tag.highlight = true;
+                ++i;
+            }
+
+            return f[i] == '}' ? i + 1 : -1;
+        }
+
+        ///
+        ///  @fn      accepts
+        ///  @brief   Determines whether a placeholder fits an argument.
+        ///  @param   spec Parsed placeholder
+        ///  @param   category Category of the argument
+        ///  @returns true if the argument can be formatted that way.
+        ///
+        static constexpr bool accepts(const Spec &spec, int category) {
+            const char t = spec.type;
+            if (spec.precision >= 0 && !(category == Float && (t == 'f' || t == 'e')))
+                return false;
+            if (spec.zero && category != Integer && category != Float)
+                return false;
+
+            switch (category) {
+            case Integer: return t == '\0' || t == 'd' || t == 'x' || t == 'o' || t == 'b';
+            case Float:   return t == '\0' || t == 'g' || t == 'f' || t == 'e';
+            case String:  return t == '\0' || t == 's';
+            case Char:    return t == '\0' || t == 'c';
+            case Bool:    return t == '\0' || t == 's';
+            default:      return false;
+            }
+        }
+
+        ///
+        ///  @fn      validate
+        ///  @brief   Checks a format string against its arguments.
+        ///  @param   f Format string
+        ///  @param   categories Category of every argument
+        ///  @param   count Amount of arguments
+        ///  @returns true if every placeholder has a fitting argument and
+        ///           every argument has a placeholder.
+        ///
+        static constexpr bool validate(const char *f, const int *categories, int count) {
+            int argument = 0;
+            int i = 0;
+
+            while (f[i] != '\0') {
+                if (f[i] == '{' && f[i + 1] == '{') {
+                    i += 2;
+                } else if (f[i] == '{' && f[i + 1] == '!') {
+                    Tag tag = { 0, false };
+                    if ((i = parseTag(f, i + 2, tag)) < 0)
+                        return false;
+                } else if (f[i] == '{') {
+                    Spec spec = { 0, 0, '\0', false };
+                    if ((i = parseSpec(f, i + 1, spec)) < 0)
+                        return false;
+                    if (argument >= count || !accepts(spec, categories[argument++]))
+                        return false;
+                } else if (f[i] == '}') {
+                    if (f[i + 1] != '}')
+                        return false;
+                    i += 2;
+                } else {
+                    ++i;
+                }
+            }
+
+            return argument == count;
+        }
+
+
+    private:
+
+        static constexpr bool isType(char c) {
+            return c == 'd' || c == 'x' || c == 'o' || c == 'b' || c == 'g' ||
+                   c == 'f' || c == 'e' || c == 's' || c == 'c';
+        }
+    };
+
+
+    ///
+    ///  @struct    QFormatCategory
+    ///  @brief     Maps an argument type to its QFormatString::Category.
+    ///
+    template <typename T, typename = void>
+    struct QFormatCategory;
+
+    template <typename T>
+    struct QFormatCategory<T, typename std::enable_if<std::is_integral<T>::value &&
+            !std::is_same<T, bool>::value && !std::is_same<T, char>::value>::type> {
+        static const int value = QFormatString::Integer;
+    };
+
+    template <typename T>
+    struct QFormatCategory<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+        static const int value = QFormatString::Float;
+    };
+
+    template <> struct QFormatCategory<bool>          { static const int value = QFormatString::Bool; };
+    template <> struct QFormatCategory<char>          { static const int value = QFormatString::Char; };
+    template <> struct QFormatCategory<QChar>         { static const int value = QFormatString::Char; };
+    template <> struct QFormatCategory<QString>       { static const int value = QFormatString::String; };
+    template <> struct QFormatCategory<QLatin1String> { static const int value = QFormatString::String; };
+    template <> struct QFormatCategory<QByteArray>    { static const int value = QFormatString::String; };
+    template <> struct QFormatCategory<const char *>  { static const int value = QFormatString::String; };
+    template <> struct QFormatCategory<char *>        { static const int value = QFormatString::String; };
+
+
+    ///
+    ///  @struct    QFormatTypes
+    ///  @brief     Validates a format string against the types A.
+    ///
+    template <typename... A>
+    struct QFormatTypes {
+        static constexpr bool validate(const char *f) {
+            const int categories[] = { QFormatCategory<typename std::decay<A>::type>::value..., -1 };
+            return QFormatString::validate(f, categories, int(sizeof...(A)));
+        }
+    };
+
+    template <typename... A>
+    QFormatTypes<A...> formatTypes(const A &...);
+
+
+    ///
+    ///  @class     QFormatArgument
+    ///  @brief     Type-erased reference to one argument of a format string.
+    ///  @note      Refers to, but never copies, strings; only valid for the
+    ///             duration of the call it was created for.
+    ///
+    class KGL_API QFormatArgument {
+    public:
+
+        QFormatArgument(bool b)                 : m_Category(QFormatString::Bool)   { m_Value.b = b; }
+        QFormatArgument(char c)                 : m_Category(QFormatString::Char)   { m_Value.c = ushort(uchar(c)); }
+        QFormatArgument(QChar c)                : m_Category(QFormatString::Char)   { m_Value.c = c.unicode(); }
+        QFormatArgument(float f)                : m_Category(QFormatString::Float)  { m_Value.f = f; m_Single = true; }
+        QFormatArgument(double d)               : m_Category(QFormatString::Float)  { m_Value.d = d; }
+        QFormatArgument(long double d)          : m_Category(QFormatString::Float)  { m_Value.d = double(d); }
+        QFormatArgument(const QString &s)       : m_Category(QFormatString::String) { m_Value.s = &s; }
+        QFormatArgument(const QLatin1String &s) : m_Category(QFormatString::String) { m_Value.l = &s; m_Kind = Latin1; }
+        QFormatArgument(const QByteArray &s)    : m_Category(QFormatString::String) { m_Value.a = &s; m_Kind = Bytes; }
+        QFormatArgument(const char *s)          : m_Category(QFormatString::String) { m_Value.u = s; m_Kind = Utf8; }
+
+        template <typename T>
+        QFormatArgument(T i, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value &&
+                        !std::is_same<T, char>::value>::type * = NULL)
+            : m_Category(QFormatString::Integer) { m_Value.i = i; m_Signed = true; }
+
+        template <typename T>
+        QFormatArgument(T i, typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value &&
+                        !std::is_same<T, bool>::value && !std::is_same<T, char>::value>::type * = NULL)
+            : m_Category(QFormatString::Integer) { m_Value.n = i; }
+
+
+    private:
+
+        friend class QTerminal;
+
+        //
+        // Storage of the referenced value
+        //
+        enum Kind {
+            Unicode,
+            Latin1,
+            Utf8,
+            Bytes
+        };
+
+        union Value {
+            qint64 i;
+            quint64 n;
+            double d;
+            float f;
+            ushort c;
+            bool b;
+            const QString *s;
+            const QLatin1String *l;
+            const QByteArray *a;
+            const char *u;
+        };
+
+        //
+        // Private class members
+        //
+        Value m_Value;
+        int m_Category;
+        Kind m_Kind = Unicode;
+        bool m_Signed = false;
+        bool m_Single = false;
+    };
+}
+
+
+#endif  // __KGL_QFORMATSTRING_HPP__
@@ -0,0 +1,121 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+#ifndef __KGL_QNUMBERFORMATTER_HPP__
+#define __KGL_QNUMBERFORMATTER_HPP__
+
+
+//
+//  Included headers
+//
+#include <KGL/KGLConfig.hpp>
+#include <KGL/Dialogs/QTerminalEnums.hpp>
+#include <QString>
+
+
+namespace kgl {
+
+    ///
+    ///  @file      QNumberFormatter.hpp
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///  @class     QNumberFormatter
+    ///  @brief     Formats integers without allocating.
+    ///
+    ///  Decimal numbers are converted two digits at a time through a
+    ///  digit-pair table, hexadecimal ones a byte at a time, octal ones
+    ///  six bits and binary ones four bits at a time. The digits are
+    ///  written straight into a caller-provided buffer.
+    ///
+    class KGL_API QNumberFormatter {
+    public:
+
+        ///
+        ///  @struct  Options
+        ///  @brief   Describes how a number is formatted.
+        ///
+        struct Options {
+            Options();
+
+            NumberFormat format;    ///< Base of the number
+            qint32 width;           ///< Minimum amount of characters
+            QChar fill;             ///< '0' pads the digits, others pad in front
+            QChar separator;        ///< Separates digit groups, null for none
+        };
+
+        ///
+        ///  @var   MaximumLength
+        ///  @brief Maximum amount of characters one number formats to.
+        ///
+        static const qint32 MaximumLength = 160;
+
+
+        ///
+        ///  @fn      format
+        ///  @brief   Formats an unsigned integer.
+        ///  @param   value Number to format
+        ///  @param   options Base, padding and grouping
+        ///  @param   out Receives at most MaximumLength characters
+        ///  @returns the amount of characters written.
+        ///  @note    Digits are grouped by three in decimal and by four
+        ///           in all other bases. The width is capped at 128.
+        ///
+        static qint32 format(quint64 value, const Options &options, QChar *out);
+
+        ///
+        ///  @fn      format
+        ///  @brief   Formats a signed integer.
+        ///  @param   value Number to format
+        ///  @param   options Base, padding and grouping
+        ///  @param   out Receives at most MaximumLength characters
+        ///  @returns the amount of characters written.
+        ///
+        static qint32 format(qint64 value, const Options &options, QChar *out);
+
+        ///
+        ///  @fn    append
+        ///  @brief Formats an unsigned integer and appends it to 'out'.
+        ///  @param value Number to format
+        ///  @param options Base, padding and grouping
+        ///  @param out String to append to
+        ///
+        static void append(quint64 value, const Options &options, QString &out);
+
+        ///
+        ///  @fn    append
+        ///  @brief Formats a signed integer and appends it to 'out'.
+        ///  @param value Number to format
+        ///  @param options Base, padding and grouping
+        ///  @param out String to append to
+        ///
+        static void append(qint64 value, const Options &options, QString &out);
+
+
+    private:
+
+        static qint32 formatDigits(quint64 value, const Options &options, bool negative, QChar *out);
+    };
+}
+
+
+#endif  // __KGL_QNUMBERFORMATTER_HPP__
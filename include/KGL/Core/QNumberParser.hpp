@@ -0,0 +1,124 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+#ifndef __KGL_QNUMBERPARSER_HPP__
+#define __KGL_QNUMBERPARSER_HPP__
+
+
+//
+//  Included headers
+//
+#include <KGL/KGLConfig.hpp>
+#include <KGL/Dialogs/QTerminalEnums.hpp>
+#include <QChar>
+#include <limits>
+
+
+namespace kgl {
+
+    ///
+    ///  @file      QNumberParser.hpp
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///  @class     QNumberParser
+    ///  @brief     Parses integers in place without allocating.
+    ///
+    ///  Accepts surrounding blanks, a sign, the prefixes '$', '&h' and
+    ///  '0x' for hexadecimal, '0o' for octal and '0b' for binary, and
+    ///  single '_' or '\'' separators between digits. A prefix overrides
+    ///  the default base, except that '0b' and '0o' are read as digits
+    ///  when the default base is hexadecimal.
+    ///
+    class KGL_API QNumberParser {
+    public:
+
+        ///
+        ///  @enum  Status
+        ///  @brief Outcome of a parse.
+        ///
+        enum class Status {
+            Ok,         ///< The text is a number within range
+            Invalid,    ///< The text is not a number
+            Overflow    ///< The number does not fit the target type
+        };
+
+
+        ///
+        ///  @fn      parse
+        ///  @brief   Parses an integer of type T.
+        ///  @param   data First character of the text
+        ///  @param   length Amount of characters
+        ///  @param   f Base to use if the text has no prefix
+        ///  @param   value Receives the number; on overflow, its lower
+        ///           bits as if wrapped, on invalid input zero
+        ///  @returns Status::Ok, Status::Invalid or Status::Overflow
+        ///
+        template <typename T>
+        static Status parse(const QChar *data, qint32 length, NumberFormat f, T &value);
+
+        ///
+        ///  @fn      parseMagnitude
+        ///  @brief   Parses the sign and magnitude of an integer.
+        ///  @param   data First character of the text
+        ///  @param   length Amount of characters
+        ///  @param   f Base to use if the text has no prefix
+        ///  @param   magnitude Receives the magnitude modulo 2^64
+        ///  @param   negative Receives true if there was a minus sign
+        ///  @returns Status::Overflow if the magnitude exceeds 64 bits.
+        ///
+        static Status parseMagnitude(const QChar *data, qint32 length, NumberFormat f,
+                                     quint64 &magnitude, bool &negative);
+    };
+
+
+    ///
+    ///  @fn        parse
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    template <typename T>
+    QNumberParser::Status QNumberParser::parse(const QChar *data, qint32 length, NumberFormat f, T &value) {
+        quint64 magnitude;
+        bool negative;
+
+        Status status = parseMagnitude(data, length, f, magnitude, negative);
+        if (status == Status::Invalid) {
+            value = 0;
+            return status;
+        }
+
+        // Signed types hold one more negative than positive number
+        const quint64 maximum = static_cast<quint64>(std::numeric_limits<T>::max());
+        const quint64 limit = !negative ? maximum
+                : std::numeric_limits<T>::is_signed ? maximum + 1 : 0;
+
+        if (magnitude > limit)
+            status = Status::Overflow;
+
+        value = static_cast<T>(negative ? Q_UINT64_C(0) - magnitude : magnitude);
+        return status;
+    }
+}
+
+
+#endif  // __KGL_QNUMBERPARSER_HPP__
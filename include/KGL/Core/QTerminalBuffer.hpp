@@ -0,0 +1,287 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+#ifndef __KGL_QTERMINALBUFFER_HPP__
+#define __KGL_QTERMINALBUFFER_HPP__
+
+
+//
+//  Included headers
+//
+#include <KGL/KGLConfig.hpp>
+#include <KGL/Core/QTerminalLineSource.hpp>
+#include <KGL/Dialogs/QTerminalEnums.hpp>
+#include <QList>
+
+
+namespace kgl {
+
+    ///
+    ///  @file      QTerminalBuffer.hpp
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///  @class     QTerminalBuffer
+    ///  @brief     Stores the terminal output as lines of styled runs.
+    ///
+    ///  The buffer does not depend on any GUI class. Every line keeps
+    ///  its text and a list of runs that map a range of characters to
+    ///  a style index; what a style looks like is up to the view. The
+    ///  oldest lines are dropped in constant time per line once one of
+    ///  the scrollback limits is exceeded.
+    ///
+    ///  Besides the output, the buffer owns the line that is currently
+    ///  being typed in. Any amount of views may display one buffer and
+    ///  edit its input; the buffer alone decides what the terminal
+    ///  holds, so it can also be driven without any widget at all.
+    ///
+    class KGL_API QTerminalBuffer : public QTerminalLineSource {
+    public:
+
+        ///
+        ///  @fn    Default constructor
+        ///  @brief Initializes a new instance of QTerminalBuffer.
+        ///
+        QTerminalBuffer();
+
+        ///
+        ///  @fn    Destructor
+        ///  @brief Frees all resources allocated by QTerminalBuffer.
+        ///
+        ~QTerminalBuffer();
+
+
+        ///
+        ///  @fn      lineCount : const
+        ///  @brief   Retrieves the amount of lines, including the last
+        ///           line that was not terminated yet.
+        ///  @returns the amount of lines (at least one).
+        ///
+        qint64 lineCount() const;
+
+        ///
+        ///  @fn      line : const
+        ///  @brief   Retrieves the line at 'index'.
+        ///  @param   index Zero-based index of the line, oldest first
+        ///  @returns the line at 'index'.
+        ///
+        const Line &line(qint64 index) const;
+
+        ///
+        ///  @fn      maximumLength : const
+        ///  @brief   Retrieves the length of the longest line held.
+        ///  @returns the maximum line length in characters.
+        ///  @note    Scans the lines once after the last line of that
+        ///           length was evicted.
+        ///
+        qint32 maximumLength() const;
+
+        ///
+        ///  @fn      heldBytes : const
+        ///  @brief   Retrieves the memory currently held by text and runs.
+        ///  @returns the amount of bytes used.
+        ///
+        qint64 heldBytes() const;
+
+        ///
+        ///  @fn      evictedLines : const
+        ///  @brief   Retrieves how many lines were dropped from the top.
+        ///  @returns the total amount of evicted lines.
+        ///
+        qint64 evictedLines() const;
+
+        ///
+        ///  @fn      maximumLines : const
+        ///  @brief   Retrieves the maximum amount of lines kept.
+        ///  @returns the line limit or 0 if unlimited.
+        ///
+        qint32 maximumLines() const;
+
+        ///
+        ///  @fn      maximumBytes : const
+        ///  @brief   Retrieves the maximum amount of memory kept.
+        ///  @returns the byte limit or 0 if unlimited.
+        ///
+        qint64 maximumBytes() const;
+
+        ///
+        ///  @fn      isReadingInput : const
+        ///  @brief   Determines whether an input line is being edited.
+        ///  @returns true if beginInput() was called and not yet finished.
+        ///
+        bool isReadingInput() const;
+
+        ///
+        ///  @fn      input : const
+        ///  @brief   Retrieves the input line typed in so far.
+        ///  @returns the pending input line.
+        ///
+        const QString &input() const;
+
+        ///
+        ///  @fn      inputCaret : const
+        ///  @brief   Retrieves the caret position within the input line.
+        ///  @returns the zero-based caret position.
+        ///
+        qint32 inputCaret() const;
+
+        ///
+        ///  @fn      inputStyle : const
+        ///  @brief   Retrieves the style the input line is drawn with.
+        ///  @returns the style index of the input.
+        ///
+        quint16 inputStyle() const;
+
+        ///
+        ///  @fn      styleOf : static
+        ///  @brief   Retrieves the style index of a text state.
+        ///  @param   state Text state to look up
+        ///  @param   highlight Use the highlighted variant?
+        ///  @returns the style index, below 8 for all text states.
+        ///
+        static quint16 styleOf(TextState state, bool highlight = false);
+
+
+        ///
+        ///  @fn    setMaximumLines
+        ///  @brief Limits the amount of lines kept in the buffer.
+        ///  @param lines Line limit, 0 for unlimited
+        ///
+        void setMaximumLines(qint32 lines);
+
+        ///
+        ///  @fn    setMaximumBytes
+        ///  @brief Limits the amount of memory kept in the buffer.
+        ///  @param bytes Byte limit, 0 for unlimited
+        ///
+        void setMaximumBytes(qint64 bytes);
+
+        ///
+        ///  @fn    append
+        ///  @brief Appends text in the given style. Line feeds start new lines.
+        ///  @param text Text to append
+        ///  @param style Style index of the text
+        ///
+        void append(const QString &text, quint16 style);
+
+        ///
+        ///  @fn    append
+        ///  @brief Appends text in the given style. Line feeds start new lines.
+        ///  @param data Characters to append
+        ///  @param length Amount of characters
+        ///  @param style Style index of the text
+        ///
+        void append(const QChar *data, qint32 length, quint16 style);
+
+        ///
+        ///  @fn    append
+        ///  @brief Appends text in the style of a text state.
+        ///  @param text Text to append
+        ///  @param state Text state of the text
+        ///  @param highlight Use the highlighted variant?
+        ///
+        void append(const QString &text, TextState state, bool highlight = false);
+
+        ///
+        ///  @fn    restyleOpenLine
+        ///  @brief Gives characters of the line not terminated yet a new
+        ///         style, e.g. once a match completes in later output.
+        ///  @param start Position of the first character in the line
+        ///  @param length Amount of characters, clamped to the line
+        ///  @param style New style index of the characters
+        ///
+        void restyleOpenLine(qint32 start, qint32 length, quint16 style);
+
+        ///
+        ///  @fn    clear
+        ///  @brief Removes all lines.
+        ///
+        void clear();
+
+        ///
+        ///  @fn    beginInput
+        ///  @brief Starts editing an empty input line after the output.
+        ///  @param style Style index the input is drawn with
+        ///
+        void beginInput(quint16 style);
+
+        ///
+        ///  @fn    endInput
+        ///  @brief Stops editing and discards the input line.
+        ///
+        void endInput();
+
+        ///
+        ///  @fn      commitInput
+        ///  @brief   Stops editing and appends the input line, followed
+        ///           by a line feed, to the output.
+        ///  @returns the input line without the line feed.
+        ///
+        QString commitInput();
+
+        ///
+        ///  @fn    insertInput
+        ///  @brief Inserts text at the caret and moves the caret behind it.
+        ///  @param text Text to insert
+        ///
+        void insertInput(const QString &text);
+
+        ///
+        ///  @fn    removeInput
+        ///  @brief Removes characters next to the caret.
+        ///  @param count Amount of characters; negative values remove
+        ///         characters before the caret, positive ones after it
+        ///
+        void removeInput(qint32 count);
+
+        ///
+        ///  @fn    setInputCaret
+        ///  @brief Moves the caret, clamped to the input line.
+        ///  @param caret New zero-based caret position
+        ///
+        void setInputCaret(qint32 caret);
+
+
+    private:
+
+        void appendToLine(const QChar *data, qint32 length, quint16 style);
+        void trim();
+
+        //
+        // Private class members
+        //
+        QList<Line> m_Lines;
+        qint64 m_HeldBytes;
+        qint64 m_EvictedLines;
+        qint64 m_MaximumBytes;
+        qint32 m_MaximumLines;
+        mutable qint32 m_MaximumLength;
+        mutable qint32 m_MaximumCount;
+        QString m_Input;
+        qint32 m_InputCaret;
+        quint16 m_InputStyle;
+        bool m_IsReadingInput;
+    };
+}
+
+
+#endif  // __KGL_QTERMINALBUFFER_HPP__
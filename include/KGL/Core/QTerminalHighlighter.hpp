@@ -0,0 +1,177 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+
+#ifndef __KGL_QTERMINALHIGHLIGHTER_HPP__
+#define __KGL_QTERMINALHIGHLIGHTER_HPP__
+
+
+//
+//  Included headers
+//
+#include <KGL/KGLConfig.hpp>
+#include <KGL/Dialogs/QTerminalEnums.hpp>
+#include <QHash>
+#include <QRegularExpression>
+#include <QString>
+#include <QVector>
+
+
+namespace kgl {
+
+    ///
+    ///  @file      QTerminalHighlighter.hpp
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///  @class     QTerminalHighlighter
+    ///  @brief     Finds the text that highlight rules apply to.
+    ///
+    ///  All literal rules are compiled into one Aho-Corasick automaton
+    ///  over case-folded characters, whose transitions are a complete
+    ///  table for ASCII; it is a single pass over the text, regardless
+    ///  of the amount of rules. Regular expressions are joined into one
+    ///  alternation, which saves a scan per rule, but the engine still
+    ///  tries every alternative at each position: their cost grows with
+    ///  the amount of expression rules, so prefer literals for large
+    ///  rule sets. The alternation stops at the first rule that matches
+    ///  at a position, so each of its hits is retried with the rules
+    ///  added later, anchored at the same start. Expressions whose
+    ///  meaning depends on group numbers or names, e.g. backreferences,
+    ///  are matched on their own. Where matches overlap, the leftmost
+    ///  one wins, then the longest, then the rule added first. In all
+    ///  expressions, '^' and '$' match at line breaks.
+    ///
+    class KGL_API QTerminalHighlighter {
+    public:
+
+        ///
+        ///  @struct  Span
+        ///  @brief   Range of characters matched by one rule.
+        ///
+        struct Span {
+            qint32 start;
+            qint32 length;
+            quint16 style;
+        };
+
+        ///
+        ///  @fn    Default constructor
+        ///  @brief Initializes a new instance of QTerminalHighlighter.
+        ///
+        QTerminalHighlighter();
+
+
+        ///
+        ///  @fn      add
+        ///  @brief   Adds a rule and recompiles the matchers.
+        ///  @param   pattern Text or regular expression to find
+        ///  @param   syntax Syntax of 'pattern'
+        ///  @param   cs Whether to match case
+        ///  @param   style Style index given to matching text
+        ///  @returns the identifier of the rule or -1 if 'pattern' is
+        ///           empty, an invalid expression or cannot be joined
+        ///           with the other expressions.
+        ///
+        qint32 add(const QString &pattern, PatternSyntax syntax, Qt::CaseSensitivity cs, quint16 style);
+
+        ///
+        ///  @fn    remove
+        ///  @brief Removes the rule with the given identifier.
+        ///  @param id Identifier returned by add()
+        ///
+        void remove(qint32 id);
+
+        ///
+        ///  @fn    clear
+        ///  @brief Removes all rules.
+        ///
+        void clear();
+
+        ///
+        ///  @fn      isEmpty : const
+        ///  @brief   Determines whether there are no rules.
+        ///  @returns true if there are no rules.
+        ///
+        bool isEmpty() const;
+
+        ///
+        ///  @fn    match : const
+        ///  @brief Finds all non-overlapping matches within the text.
+        ///  @param data Text to search
+        ///  @param length Amount of characters
+        ///  @param spans Receives the matches, sorted by position
+        ///  @param from First position a match may start at; the text
+        ///         before it is only seen by '^' and lookbehinds
+        ///
+        void match(const QChar *data, qint32 length, QVector<Span> &spans, qint32 from = 0) const;
+
+
+    private:
+
+        //
+        // Registered rule
+        //
+        struct Rule {
+            QString pattern;
+            PatternSyntax syntax;
+            Qt::CaseSensitivity cs;
+            quint16 style;
+            qint32 id;
+            qint32 group;       ///< Capture group within the alternation, 0 if alone
+            qint32 next;        ///< Next literal rule with the same folded text
+        };
+
+        //
+        // Node of the literal automaton
+        //
+        struct State {
+            qint32 next[128];   ///< Complete transitions for ASCII
+            qint32 fail;
+            qint32 output;      ///< First rule ending here, -1 if none
+            qint32 dictionary;  ///< Closest fail state with an output
+        };
+
+        bool compile();
+        void compileLiterals();
+        bool compileExpressions();
+        static bool isJoinable(const QString &pattern);
+        qint32 wideTransition(qint32 state, ushort c) const;
+        static ushort fold(ushort c);
+
+        //
+        // Private class members
+        //
+        QVector<Rule> m_Rules;
+        QVector<State> m_States;
+        QHash<quint64, qint32> m_WideEdges;
+        QVector<qint32> m_ExpressionRules;
+        QVector<QRegularExpression> m_JoinedExpressions;
+        QVector<qint32> m_SeparateRules;
+        QVector<QRegularExpression> m_SeparateExpressions;
+        QRegularExpression m_Expression;
+        qint32 m_NextId;
+    };
+}
+
+
+#endif  // __KGL_QTERMINALHIGHLIGHTER_HPP__
@@ -0,0 +1,111 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+
+#ifndef __KGL_QTERMINALLINESOURCE_HPP__
+#define __KGL_QTERMINALLINESOURCE_HPP__
+
+
+//
+//  Included headers
+//
+#include <KGL/KGLConfig.hpp>
+#include <QString>
+#include <QVector>
+
+
+namespace kgl {
+
+    ///
+    ///  @file      QTerminalLineSource.hpp
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///  @class     QTerminalLineSource
+    ///  @brief     Lines of styled runs, as painted by QTerminalView.
+    ///
+    ///  The view only ever asks for the lines in its viewport, so a
+    ///  source is free to materialize lines on demand instead of
+    ///  keeping all of them in memory.
+    ///
+    class KGL_API QTerminalLineSource {
+    public:
+
+        ///
+        ///  @struct  Run
+        ///  @brief   Range of characters within a line sharing one style.
+        ///
+        struct Run {
+            qint32 start;
+            qint32 length;
+            quint16 style;
+        };
+
+        ///
+        ///  @struct  Line
+        ///  @brief   Text of one line and its styled runs.
+        ///
+        struct Line {
+            QString text;
+            QVector<Run> runs;
+        };
+
+        ///
+        ///  @fn    Destructor
+        ///  @brief Frees all resources allocated by the source.
+        ///
+        virtual ~QTerminalLineSource() { }
+
+
+        ///
+        ///  @fn      lineCount : const
+        ///  @brief   Retrieves the amount of lines available.
+        ///  @returns the amount of lines.
+        ///
+        virtual qint64 lineCount() const = 0;
+
+        ///
+        ///  @fn      line : const
+        ///  @brief   Retrieves the line at 'index'.
+        ///  @param   index Zero-based index of the line, oldest first
+        ///  @returns the line at 'index', valid until the next call.
+        ///
+        virtual const Line &line(qint64 index) const = 0;
+
+        ///
+        ///  @fn      maximumLength : const
+        ///  @brief   Retrieves the length of the longest line seen so far.
+        ///  @returns the maximum line length in characters.
+        ///
+        virtual qint32 maximumLength() const = 0;
+
+        ///
+        ///  @fn      evictedLines : const
+        ///  @brief   Retrieves how many lines were dropped from the top.
+        ///  @returns the total amount of evicted lines.
+        ///
+        virtual qint64 evictedLines() const { return 0; }
+    };
+}
+
+
+#endif  // __KGL_QTERMINALLINESOURCE_HPP__
@@ -0,0 +1,183 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+#ifndef __KGL_QTERMINALLOG_HPP__
+#define __KGL_QTERMINALLOG_HPP__
+
+
+//
+//  Included headers
+//
+#include <KGL/KGLConfig.hpp>
+#include <KGL/Core/QAnsiParser.hpp>
+#include <KGL/Dialogs/QTerminalEnums.hpp>
+#include <QFile>
+#include <QMutex>
+#include <QThread>
+#include <QVector>
+#include <QWaitCondition>
+
+
+namespace kgl {
+
+    ///
+    ///  @file      QTerminalLog.hpp
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///  @class     QTerminalLog
+    ///  @brief     Mirrors terminal output into a file on its own thread.
+    ///
+    ///  Producers only append to an in-memory queue under a short lock;
+    ///  the thread swaps the whole queue out, encodes it and writes it
+    ///  in one large sequential write. The queue is bounded: when the
+    ///  disk falls behind, new output is dropped and counted instead of
+    ///  blocking, and the log notes how much was lost.
+    ///
+    class KGL_API QTerminalLog : public QThread {
+    public:
+
+        ///
+        ///  @fn    Default constructor
+        ///  @brief Initializes a new instance of QTerminalLog.
+        ///
+        QTerminalLog();
+
+        ///
+        ///  @fn    Destructor
+        ///  @brief Writes the remaining output and closes the file.
+        ///
+        ~QTerminalLog();
+
+
+        ///
+        ///  @fn    open
+        ///  @brief Starts mirroring into the file at 'path'.
+        ///  @param path File to append to
+        ///  @param encoding Plain text, ANSI SGR sequences or HTML
+        ///  @note  The file is opened on the log thread; errorString()
+        ///         tells whether that failed. An HTML log written by a
+        ///         previous session is continued in front of its footer.
+        ///
+        void open(const QString &path, LogEncoding encoding = LogEncoding::Plain);
+
+        ///
+        ///  @fn    close
+        ///  @brief Stops mirroring once the queued output is written.
+        ///  @note  Does not wait for the thread; QThread::wait does.
+        ///
+        void close();
+
+        ///
+        ///  @fn    setRotation
+        ///  @brief Specifies when the log file is rotated.
+        ///  @param maximumSize Size in bytes after which a new file is
+        ///         started, 0 to never rotate. Output is split at this
+        ///         size, so a file only exceeds it by a style change
+        ///         and the HTML footer.
+        ///  @param maximumFiles Amount of files kept, including the
+        ///         current one; older files are named 'path.1', 'path.2'...
+        ///
+        void setRotation(qint64 maximumSize, int maximumFiles = 5);
+
+        ///
+        ///  @fn    setMaximumQueuedBytes
+        ///  @brief Specifies how much output may wait for the disk.
+        ///  @param bytes Limit in bytes, 8 MiB by default
+        ///
+        void setMaximumQueuedBytes(qint64 bytes);
+
+        ///
+        ///  @fn      droppedBytes : const
+        ///  @brief   Retrieves how much output was dropped in total.
+        ///  @returns the amount of dropped bytes.
+        ///
+        qint64 droppedBytes() const;
+
+        ///
+        ///  @fn      errorString : const
+        ///  @brief   Retrieves the last file error.
+        ///  @returns the error or an empty string.
+        ///
+        QString errorString() const;
+
+        ///
+        ///  @fn    append
+        ///  @brief Queues text for the file.
+        ///  @param text Text to write
+        ///  @param attributes Graphic rendition of the text
+        ///  @note  Thread-safe and never waits for the disk.
+        ///
+        void append(const QString &text, const QAnsiParser::Attributes &attributes);
+
+
+    protected:
+
+        void run();
+
+
+    private:
+
+        //
+        // Text waiting for the disk
+        //
+        struct Record {
+            QString text;
+            QAnsiParser::Attributes attributes;
+        };
+
+        bool openFile();
+        void closeFile();
+        void rotate();
+        void writeOut(QByteArray &out);
+        void encodeSplit(const Record &record, qint64 maximumSize, QByteArray &out);
+        void encode(const Record &record, QByteArray &out);
+        void encodeAnsi(const QAnsiParser::Attributes &a, QByteArray &out);
+        void encodeHtml(const QAnsiParser::Attributes &a, QByteArray &out);
+
+        //
+        // Private class members
+        //
+        mutable QMutex m_Mutex;
+        QWaitCondition m_Condition;
+        QVector<Record> m_Records;
+        QFile m_File;
+        QString m_Path;
+        QString m_Error;
+        QAnsiParser::Attributes m_Last;
+        LogEncoding m_Encoding;
+        qint64 m_MaximumSize;
+        qint64 m_FileSize;
+        qint64 m_MaximumQueued;
+        qint64 m_Queued;
+        qint64 m_Dropped;
+        qint64 m_DroppedTotal;
+        int m_MaximumFiles;
+        bool m_HasLast;
+        bool m_Stop;
+
+        Q_DISABLE_COPY(QTerminalLog)
+    };
+}
+
+
+#endif  // __KGL_QTERMINALLOG_HPP__
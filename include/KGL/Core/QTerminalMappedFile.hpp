@@ -0,0 +1,186 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+
+#ifndef __KGL_QTERMINALMAPPEDFILE_HPP__
+#define __KGL_QTERMINALMAPPEDFILE_HPP__
+
+
+//
+//  Included headers
+//
+#include <KGL/KGLConfig.hpp>
+#include <KGL/Core/QAnsiParser.hpp>
+#include <KGL/Core/QTerminalLineSource.hpp>
+#include <QAtomicInt>
+#include <QFile>
+#include <QMutex>
+#include <QThread>
+#include <functional>
+
+
+namespace kgl {
+
+    ///
+    ///  @file      QTerminalMappedFile.hpp
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///  @class     QTerminalMappedFile
+    ///  @brief     Presents a memory-mapped text file as terminal lines.
+    ///
+    ///  Opening only maps the file; its own thread then scans it for
+    ///  line feeds and publishes the offset of every IndexInterval-th
+    ///  line, so lines become visible while the scan is running. Lines
+    ///  are decoded and their ANSI sequences interpreted only when they
+    ///  are asked for, and only a small window of them is kept. Every
+    ///  line starts with the default attributes.
+    ///
+    class KGL_API QTerminalMappedFile : public QThread, public QTerminalLineSource {
+    public:
+
+        ///
+        ///  @typedef StyleResolver
+        ///  @brief   Maps ANSI attributes to the style index of a run.
+        ///
+        typedef std::function<quint16(const QAnsiParser::Attributes &)> StyleResolver;
+
+        static const qint32 IndexInterval = 64;
+        static const qint32 CacheLines = 256;
+        static const qint32 MaximumLineLength = 16384;
+
+        ///
+        ///  @fn    Default constructor
+        ///  @brief Initializes a new instance of QTerminalMappedFile.
+        ///
+        QTerminalMappedFile();
+
+        ///
+        ///  @fn    Destructor
+        ///  @brief Stops indexing and unmaps the file.
+        ///
+        ~QTerminalMappedFile();
+
+
+        ///
+        ///  @fn      open
+        ///  @brief   Maps the file at 'path' and starts indexing it.
+        ///  @param   path File to view
+        ///  @returns false if the file could not be mapped.
+        ///
+        bool open(const QString &path);
+
+        ///
+        ///  @fn    close
+        ///  @brief Stops indexing and unmaps the file.
+        ///
+        void close();
+
+        ///
+        ///  @fn      isIndexed : const
+        ///  @brief   Determines whether all lines have been found.
+        ///  @returns true if indexing has finished.
+        ///
+        bool isIndexed() const;
+
+        ///
+        ///  @fn      size : const
+        ///  @brief   Retrieves the size of the mapped file.
+        ///  @returns the size in bytes.
+        ///
+        qint64 size() const;
+
+        ///
+        ///  @fn      errorString : const
+        ///  @brief   Retrieves the reason why open() failed.
+        ///  @returns the error or an empty string.
+        ///
+        QString errorString() const;
+
+        ///
+        ///  @fn    setStyleResolver
+        ///  @brief Specifies how ANSI attributes become style indices.
+        ///  @param resolver Called on the thread that reads lines; by
+        ///         default, the plain state and highlight are used
+        ///
+        void setStyleResolver(const StyleResolver &resolver);
+
+
+        ///
+        ///  @fn      lineCount : const
+        ///  @brief   Retrieves the amount of lines indexed so far.
+        ///  @returns the amount of lines.
+        ///
+        qint64 lineCount() const;
+
+        ///
+        ///  @fn      line : const
+        ///  @brief   Decodes the line at 'index'.
+        ///  @param   index Zero-based index of an indexed line
+        ///  @returns the line, valid until the next call.
+        ///  @note    Lines longer than MaximumLineLength bytes are cut.
+        ///
+        const Line &line(qint64 index) const;
+
+        ///
+        ///  @fn      maximumLength : const
+        ///  @brief   Retrieves the length of the longest line indexed.
+        ///  @returns the maximum line length in bytes.
+        ///
+        qint32 maximumLength() const;
+
+
+    protected:
+
+        void run();
+
+
+    private:
+
+        qint64 lineEnd(qint64 offset) const;
+        void decode(qint64 offset, qint64 end, Line &line) const;
+        quint16 resolve(const QAnsiParser::Attributes &attributes) const;
+
+        //
+        // Private class members
+        //
+        mutable QMutex m_Mutex;
+        mutable QAnsiParser m_Ansi;
+        mutable QVector<Line> m_Cache;
+        mutable qint64 m_CacheFirst;
+        QFile m_File;
+        QVector<qint64> m_Checkpoints;
+        StyleResolver m_Resolver;
+        QString m_Error;
+        const uchar *m_Data;
+        qint64 m_Size;
+        qint64 m_LineCount;
+        qint32 m_MaximumLength;
+        QAtomicInt m_Stop;
+        bool m_IsIndexed;
+
+        Q_DISABLE_COPY(QTerminalMappedFile)
+    };
+}
+
+
+#endif  // __KGL_QTERMINALMAPPEDFILE_HPP__
@@ -0,0 +1,212 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+#ifndef __KGL_QTERMINALPROCESS_HPP__
+#define __KGL_QTERMINALPROCESS_HPP__
+
+
+//
+//  Included headers
+//
+#include <KGL/KGLConfig.hpp>
+#include <QAtomicInt>
+#include <QByteArray>
+#include <QMutex>
+#include <QStringList>
+#include <QThread>
+#include <QVector>
+#include <QWaitCondition>
+#include <functional>
+
+
+namespace kgl {
+
+    ///
+    ///  @file      QTerminalProcess.hpp
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///  @class     QTerminalProcess
+    ///  @brief     Runs a child process and reads its output on its own
+    ///             thread.
+    ///
+    ///  The thread reads whatever the child wrote into one bounded
+    ///  buffer, which the GUI thread takes as a whole. Once the buffer is
+    ///  full the thread stops reading, the pipe fills up and the child
+    ///  blocks in its next write, so a chatty child is slowed down to
+    ///  the pace of the consumer instead of flooding it.
+    ///
+    ///  On Unix the child is attached through pipes or, for interactive
+    ///  tools, through a pseudo-terminal. On Windows QProcess is used and
+    ///  a pseudo-terminal is not available.
+    ///
+    class KGL_API QTerminalProcess : public QThread {
+    public:
+
+        ///
+        ///  @struct  Chunk
+        ///  @brief   Output of one stream, in the order it was read.
+        ///
+        struct Chunk {
+            QByteArray data;
+            bool isError;
+        };
+
+        ///
+        ///  @fn    Default constructor
+        ///  @brief Initializes a new instance of QTerminalProcess.
+        ///
+        QTerminalProcess();
+
+        ///
+        ///  @fn    Destructor
+        ///  @brief Kills the child if it is still running.
+        ///
+        ~QTerminalProcess();
+
+
+        ///
+        ///  @fn      start
+        ///  @brief   Starts 'program' and begins reading its output.
+        ///  @param   program Program to run; looked up in PATH
+        ///  @param   arguments Arguments passed to the program
+        ///  @param   usePty True to attach through a pseudo-terminal, in
+        ///           which case stdout and stderr are one stream
+        ///  @returns false if the program could not be started.
+        ///
+        bool start(const QString &program, const QStringList &arguments, bool usePty);
+
+        ///
+        ///  @fn      usesPty : const
+        ///  @returns true if the child runs on a pseudo-terminal.
+        ///
+        bool usesPty() const;
+
+        ///
+        ///  @fn      isFinished : const
+        ///  @returns true once the child exited and all of its output
+        ///           was read.
+        ///
+        bool isFinished() const;
+
+        ///
+        ///  @fn      exitCode : const
+        ///  @returns the exit code, or 128 plus the signal number if the
+        ///           child was killed by a signal.
+        ///
+        int exitCode() const;
+
+        ///
+        ///  @fn      errorString : const
+        ///  @brief   Retrieves why the program could not be started.
+        ///  @returns the error or an empty string.
+        ///
+        QString errorString() const;
+
+        ///
+        ///  @fn    setMaximumBuffered
+        ///  @brief Specifies how much output is read ahead of take().
+        ///  @param bytes Limit in bytes, 1 MiB by default
+        ///
+        void setMaximumBuffered(qint64 bytes);
+
+        ///
+        ///  @fn    setWindowSize
+        ///  @brief Tells a child on a pseudo-terminal its window size.
+        ///  @param columns Amount of columns
+        ///  @param rows Amount of rows
+        ///
+        void setWindowSize(int columns, int rows);
+
+        ///
+        ///  @fn    setNotifier
+        ///  @brief Specifies what to call once output was read or the
+        ///         child finished.
+        ///  @param notifier Called on the process thread
+        ///
+        void setNotifier(const std::function<void()> &notifier);
+
+        ///
+        ///  @fn    take
+        ///  @brief Moves all output read so far into 'chunks' and lets
+        ///         the thread read more.
+        ///  @param chunks Receives the output
+        ///
+        void take(QVector<Chunk> &chunks);
+
+        ///
+        ///  @fn    write
+        ///  @brief Queues data for the standard input of the child.
+        ///  @param data Data to write
+        ///
+        void write(const QByteArray &data);
+
+
+    protected:
+
+        void run();
+
+
+    private:
+
+        bool append(const char *data, qint64 length, bool isError);
+        void finish(int exitCode);
+#ifdef Q_OS_WIN
+        void runProcess();
+#else
+        bool startUnix();
+        bool readDescriptor(int fd, bool isError);
+        void writeInput();
+        void reap();
+        void wake();
+        void closeDescriptors();
+#endif
+
+        //
+        // Private class members
+        //
+        mutable QMutex m_Mutex;
+        QWaitCondition m_Condition;
+        QVector<Chunk> m_Chunks;
+        QByteArray m_Input;
+        QString m_Program;
+        QStringList m_Arguments;
+        QString m_Error;
+        std::function<void()> m_Notifier;
+        QAtomicInt m_IsFinished;
+        qint64 m_Buffered;
+        qint64 m_MaximumBuffered;
+        qint64 m_Pid;
+        int m_ExitCode;
+        int m_InputFd;
+        int m_OutputFd;
+        int m_ErrorFd;
+        int m_WakeFds[2];
+        bool m_UsesPty;
+        bool m_IsStarted;
+        bool m_Stop;
+
+        Q_DISABLE_COPY(QTerminalProcess)
+    };
+}
+
+
+#endif  // __KGL_QTERMINALPROCESS_HPP__
@@ -0,0 +1,121 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+#ifndef __KGL_QTERMINALQUEUE_HPP__
+#define __KGL_QTERMINALQUEUE_HPP__
+
+
+//
+//  Included headers
+//
+#include <KGL/KGLConfig.hpp>
+#include <KGL/Dialogs/QTerminalEnums.hpp>
+#include <QAtomicPointer>
+#include <QString>
+
+
+namespace kgl {
+
+    ///
+    ///  @file      QTerminalQueue.hpp
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///  @class     QTerminalQueue
+    ///  @brief     Lock-free multi-producer, single-consumer queue of
+    ///             output records.
+    ///
+    ///  Any thread may push records; only one thread (the GUI thread
+    ///  of the owning terminal) may pop them. A push costs one node
+    ///  allocation and one atomic exchange, and never waits on the
+    ///  consumer or on other producers.
+    ///
+    class KGL_API QTerminalQueue {
+    public:
+
+        ///
+        ///  @struct  Record
+        ///  @brief   One piece of text together with its format.
+        ///
+        struct Record {
+            QString text;
+            TextState state;
+            bool highlight;
+        };
+
+        ///
+        ///  @fn    Default constructor
+        ///  @brief Initializes a new, empty instance of QTerminalQueue.
+        ///
+        QTerminalQueue();
+
+        ///
+        ///  @fn    Destructor
+        ///  @brief Frees all records that were not popped yet.
+        ///
+        ~QTerminalQueue();
+
+
+        ///
+        ///  @fn      push
+        ///  @brief   Enqueues a record. Safe to call from any thread.
+        ///  @param   text Text to enqueue
+        ///  @param   state Format of the text
+        ///  @param   highlight True if highlighted text
+        ///
+        void push(const QString &text, TextState state, bool highlight);
+
+        ///
+        ///  @fn      pop
+        ///  @brief   Dequeues the oldest record. Consumer thread only.
+        ///  @param   record Receives the dequeued record
+        ///  @returns false if the queue is empty.
+        ///  @note    May return false while a producer is in the middle
+        ///           of a push; the record will be visible shortly after.
+        ///
+        bool pop(Record &record);
+
+
+    private:
+
+        //
+        // Intrusive queue node
+        //
+        struct Node {
+            QAtomicPointer<Node> next;
+            Record record;
+        };
+
+        void pushNode(Node *node);
+
+        //
+        // Private class members
+        //
+        QAtomicPointer<Node> m_Head;    ///< Written by producers
+        Node *m_Tail;                   ///< Owned by the consumer
+        Node m_Stub;
+
+        Q_DISABLE_COPY(QTerminalQueue)
+    };
+}
+
+
+#endif  // __KGL_QTERMINALQUEUE_HPP__
@@ -0,0 +1,251 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+#ifndef __KGL_QTERMINALRECORDER_HPP__
+#define __KGL_QTERMINALRECORDER_HPP__
+
+
+//
+//  Included headers
+//
+#include <KGL/KGLConfig.hpp>
+#include <KGL/Dialogs/QTerminalEnums.hpp>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QHash>
+#include <QMutex>
+#include <QThread>
+#include <QVector>
+#include <QWaitCondition>
+
+
+namespace kgl {
+
+    ///
+    ///  @file      QTerminalRecorder.hpp
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///  @class     QTerminalRecorder
+    ///  @brief     Records a terminal session into a compact binary file.
+    ///
+    ///  file   := "QTRM" version:u8 record*
+    ///  record := kind:u8 delay:varint style:u8 payload
+    ///
+    ///  The delay is given in microseconds since the previous record and
+    ///  the style byte is state * 2 + highlight. Text and Input records
+    ///  carry a varint byte length and UTF-8; a Text record of at most
+    ///  MaximumInterned bytes is appended to a string table, and every
+    ///  later occurrence is stored as a TextRef record holding its varint
+    ///  table index. Varints store seven bits per byte, least significant
+    ///  group first.
+    ///
+    ///  Records are encoded on the calling thread and handed to the
+    ///  recorder's own thread on every flush() and every 64 KiB. That
+    ///  thread joins whatever was handed off meanwhile into one write,
+    ///  so a stalling disk never blocks the terminal, and a crash loses
+    ///  at most the records since the last flush(). The queue of chunks
+    ///  is not bounded, since a gap would corrupt the string table.
+    ///
+    class KGL_API QTerminalRecorder : public QThread {
+    public:
+
+        ///
+        ///  @enum  Kind
+        ///  @brief Types of records.
+        ///
+        enum Kind {
+            Text,
+            TextRef,
+            Input
+        };
+
+        static const int Version = 1;
+        static const int MaximumInterned = 256;     ///< Longest interned text in bytes
+        static const int MaximumStrings = 65536;    ///< Size limit of the string table
+
+
+        ///
+        ///  @fn    Default constructor
+        ///  @brief Initializes a new instance of QTerminalRecorder.
+        ///
+        QTerminalRecorder();
+
+        ///
+        ///  @fn    Destructor
+        ///  @brief Writes the remaining records and closes the file.
+        ///
+        ~QTerminalRecorder();
+
+
+        ///
+        ///  @fn      open
+        ///  @brief   Starts a new recording.
+        ///  @param   path File to create
+        ///  @returns true if the file could be created.
+        ///
+        bool open(const QString &path);
+
+        ///
+        ///  @fn    close
+        ///  @brief Writes the remaining records and closes the file.
+        ///  @note  Waits until the recorder's thread wrote everything.
+        ///
+        void close();
+
+        ///
+        ///  @fn      isOpen : const
+        ///  @brief   Determines whether a recording is in progress.
+        ///  @returns true if recording.
+        ///
+        bool isOpen() const;
+
+        ///
+        ///  @fn    recordText
+        ///  @brief Records output.
+        ///  @param text Text that was written
+        ///  @param state Format of the text
+        ///  @param highlight True if highlighted text
+        ///
+        void recordText(const QString &text, TextState state, bool highlight);
+
+        ///
+        ///  @fn    recordInput
+        ///  @brief Records a line typed into a read.
+        ///  @param line Text that was typed, without line break
+        ///  @param state Format of the typed text
+        ///  @param highlight True if highlighted text
+        ///
+        void recordInput(const QString &line, TextState state, bool highlight);
+
+        ///
+        ///  @fn    flush
+        ///  @brief Hands the records so far to the recorder's thread.
+        ///  @note  QTerminal calls this once per batch of output.
+        ///
+        void flush();
+
+
+    protected:
+
+        void run();
+
+
+    private:
+
+        void writeHeader(Kind kind, TextState state, bool highlight);
+        void writeVarint(quint64 value);
+        void writeBytes(const QByteArray &bytes);
+        void handOff(bool force);
+
+        //
+        // Private class members
+        //
+        QMutex m_Mutex;
+        QWaitCondition m_Condition;
+        QVector<QByteArray> m_Chunks;
+        QFile m_File;
+        QByteArray m_Buffer;
+        QHash<QString, quint32> m_Strings;
+        QElapsedTimer m_Clock;
+        qint64 m_LastTime;
+        bool m_IsOpen;
+        bool m_Stop;
+
+        Q_DISABLE_COPY(QTerminalRecorder)
+    };
+
+
+    ///
+    ///  @class     QTerminalReplay
+    ///  @brief     Reads the records of a session file.
+    ///
+    ///  The file is mapped into memory rather than read, so only the
+    ///  pages around the current record are resident, whatever the
+    ///  length of the session. Files that cannot be mapped are read.
+    ///
+    class KGL_API QTerminalReplay {
+    public:
+
+        ///
+        ///  @struct  Event
+        ///  @brief   One recorded output or input.
+        ///
+        struct Event {
+            QString text;
+            qint64 time;            ///< Microseconds since the recording began
+            TextState state;
+            bool highlight;
+            bool isInput;
+        };
+
+        ///
+        ///  @fn    Default constructor
+        ///  @brief Initializes a new instance of QTerminalReplay.
+        ///
+        QTerminalReplay();
+
+
+        ///
+        ///  @fn      open
+        ///  @brief   Loads a session file.
+        ///  @param   path File written by QTerminalRecorder
+        ///  @returns false if the file cannot be read or is no session.
+        ///
+        bool open(const QString &path);
+
+        ///
+        ///  @fn      next
+        ///  @brief   Reads the next event.
+        ///  @param   event Receives the event
+        ///  @returns false at the end or if the file is truncated.
+        ///
+        bool next(Event &event);
+
+        ///
+        ///  @fn    rewind
+        ///  @brief Starts reading from the first event again.
+        ///
+        void rewind();
+
+
+    private:
+
+        bool readVarint(quint64 &value);
+
+        //
+        // Private class members
+        //
+        QFile m_File;
+        QByteArray m_Buffer;
+        QVector<QString> m_Strings;
+        const char *m_Data;
+        qint64 m_Size;
+        qint64 m_Time;
+        qint64 m_Position;
+
+        Q_DISABLE_COPY(QTerminalReplay)
+    };
+}
+
+
+#endif  // __KGL_QTERMINALRECORDER_HPP__
@@ -0,0 +1,208 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+
+#ifndef __KGL_QTERMINALSEARCH_HPP__
+#define __KGL_QTERMINALSEARCH_HPP__
+
+
+//
+//  Included headers
+//
+#include <KGL/KGLConfig.hpp>
+#include <QMutex>
+#include <QString>
+#include <QThread>
+#include <QVector>
+#include <QWaitCondition>
+#include <functional>
+
+
+namespace kgl {
+
+    ///
+    ///  @file      QTerminalSearch.hpp
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///  @class     QTerminalSearch
+    ///  @brief     Searches snapshots of terminal lines on its own thread.
+    ///
+    ///  Lines are handed over as copies of their (implicitly shared)
+    ///  text together with the absolute number of the first one, so
+    ///  that the terminal may keep writing and evicting meanwhile. The
+    ///  matches are kept sorted by position; looking up the matches of
+    ///  a range of lines or the next match is a binary search.
+    ///
+    class KGL_API QTerminalSearch : public QThread {
+    public:
+
+        ///
+        ///  @struct  Match
+        ///  @brief   Characters within an absolute line that matched.
+        ///
+        struct Match {
+            qint64 line;
+            qint32 start;
+            qint32 length;
+        };
+
+        ///
+        ///  @fn    Default constructor
+        ///  @brief Initializes a new instance of QTerminalSearch.
+        ///
+        QTerminalSearch();
+
+        ///
+        ///  @fn    Destructor
+        ///  @brief Stops the search thread.
+        ///
+        ~QTerminalSearch();
+
+
+        ///
+        ///  @fn    setPattern
+        ///  @brief Starts a new search; drops all matches and queued lines.
+        ///  @param pattern Text or regular expression to find
+        ///  @param isRegex True if 'pattern' is a regular expression
+        ///  @param caseSensitive True to match case
+        ///
+        void setPattern(const QString &pattern, bool isRegex, bool caseSensitive);
+
+        ///
+        ///  @fn      pattern : const
+        ///  @brief   Retrieves the pattern searched for.
+        ///  @returns the pattern or an empty string.
+        ///
+        QString pattern() const;
+
+        ///
+        ///  @fn      isValid : const
+        ///  @brief   Determines whether the pattern can be searched for.
+        ///  @returns false for an invalid regular expression.
+        ///
+        bool isValid() const;
+
+        ///
+        ///  @fn    append
+        ///  @brief Queues lines to be searched.
+        ///  @param first Absolute number of the first line
+        ///  @param lines Text of the lines
+        ///  @note  Matches found earlier at or behind 'first' are
+        ///         replaced, so an unterminated last line may be passed
+        ///         again once it grew.
+        ///
+        void append(qint64 first, const QVector<QString> &lines);
+
+        ///
+        ///  @fn    discardBefore
+        ///  @brief Drops the matches of evicted lines.
+        ///  @param line Absolute number of the first line still existing
+        ///
+        void discardBefore(qint64 line);
+
+        ///
+        ///  @fn    clear
+        ///  @brief Drops all matches and queued lines; keeps the pattern.
+        ///
+        void clear();
+
+        ///
+        ///  @fn    setNotifier
+        ///  @brief Specifies what to call once new matches were found.
+        ///  @param notifier Called on the search thread
+        ///
+        void setNotifier(const std::function<void()> &notifier);
+
+
+        ///
+        ///  @fn      count : const
+        ///  @brief   Retrieves the amount of matches found so far.
+        ///  @returns the amount of matches.
+        ///
+        qint32 count() const;
+
+        ///
+        ///  @fn      matches : const
+        ///  @brief   Retrieves the matches within a range of lines.
+        ///  @param   first Absolute number of the first line
+        ///  @param   last Absolute number of the last line, inclusive
+        ///  @returns the matches, sorted by position.
+        ///
+        QVector<Match> matches(qint64 first, qint64 last) const;
+
+        ///
+        ///  @fn      find : const
+        ///  @brief   Finds the match following or preceding a position.
+        ///  @param   line Absolute line of the position
+        ///  @param   column Column of the position
+        ///  @param   backwards True to find the preceding match
+        ///  @param   match Receives the match; wraps around at the ends
+        ///  @returns false if there are no matches.
+        ///
+        bool find(qint64 line, qint32 column, bool backwards, Match &match) const;
+
+        ///
+        ///  @fn      indexOf : const
+        ///  @brief   Retrieves the position of a match in the results.
+        ///  @param   match Match returned by find()
+        ///  @returns the zero-based index or -1 if it no longer exists.
+        ///
+        qint32 indexOf(const Match &match) const;
+
+
+    protected:
+
+        void run();
+
+
+    private:
+
+        //
+        // Lines waiting to be searched
+        //
+        struct Job {
+            QVector<QString> lines;
+            qint64 first;
+        };
+
+        //
+        // Private class members
+        //
+        mutable QMutex m_Mutex;
+        QWaitCondition m_Condition;
+        QVector<Job> m_Jobs;
+        QVector<Match> m_Matches;
+        std::function<void()> m_Notifier;
+        QString m_Pattern;
+        quint32 m_Generation;
+        bool m_IsRegex;
+        bool m_CaseSensitive;
+        bool m_IsValid;
+        bool m_Stop;
+
+        Q_DISABLE_COPY(QTerminalSearch)
+    };
+}
+
+
+#endif  // __KGL_QTERMINALSEARCH_HPP__
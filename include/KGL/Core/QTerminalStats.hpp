@@ -0,0 +1,205 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+#ifndef __KGL_QTERMINALSTATS_HPP__
+#define __KGL_QTERMINALSTATS_HPP__
+
+
+//
+//  Included headers
+//
+#include <KGL/KGLConfig.hpp>
+#include <QAtomicInteger>
+#include <QElapsedTimer>
+
+
+namespace kgl {
+
+    ///
+    ///  @file      QTerminalStats.hpp
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///  @class     QTerminalStats
+    ///  @brief     Performance counters of one terminal.
+    ///
+    ///  Every counter is a relaxed atomic that is bumped once per batch,
+    ///  frame or read, never once per written character, so the counters
+    ///  stay enabled at all times. Only post() touches them from other
+    ///  threads.
+    ///
+    class KGL_API QTerminalStats {
+    public:
+
+        /// Bucket i counts durations below 2^i microseconds.
+        static const qint32 HistogramBuckets = 20;
+
+        ///
+        ///  @struct  Histogram
+        ///  @brief   Distribution of a duration.
+        ///
+        struct Histogram {
+            qint64 buckets[HistogramBuckets];
+            qint64 count;
+            qint64 totalNsecs;
+            qint64 maximumNsecs;
+
+            ///
+            ///  @fn      percentile : const
+            ///  @brief   Estimates a percentile from the buckets.
+            ///  @param   p Percentile within [0, 1]
+            ///  @returns the upper bound of the bucket, in microseconds.
+            ///
+            qint64 percentile(double p) const;
+
+            ///
+            ///  @fn      averageNsecs : const
+            ///  @returns the mean duration in nanoseconds.
+            ///
+            qint64 averageNsecs() const;
+        };
+
+        ///
+        ///  @struct  Snapshot
+        ///  @brief   Values of all counters at one point in time.
+        ///
+        struct Snapshot {
+            qint64 charactersWritten;   ///< Characters applied in total
+            qint64 linesWritten;        ///< Lines applied in total
+            double charactersPerSecond; ///< Over the last second or more
+            double linesPerSecond;      ///< Over the last second or more
+            qint64 queuedRecords;       ///< Posted but not drained yet
+            qint64 pendingRuns;         ///< Drained but not applied yet
+            qint64 blockCount;          ///< Lines held by the output
+            qint64 heldBytes;           ///< Estimated memory of the output
+            qint64 reads;               ///< Blocking reads completed
+            qint64 readBlockedNsecs;    ///< Time spent in blocking reads
+            Histogram flushLatency;     ///< First write until applied
+            Histogram applyTime;        ///< Duration of one flush
+            Histogram paintTime;        ///< Duration of one frame
+        };
+
+        ///
+        ///  @fn    Default constructor
+        ///  @brief Initializes all counters with zero.
+        ///
+        QTerminalStats();
+
+
+        ///
+        ///  @fn    addOutput
+        ///  @brief Counts one applied batch of output.
+        ///  @param characters Characters in the batch
+        ///  @param lines Lines the output grew by
+        ///
+        void addOutput(qint64 characters, qint64 lines);
+
+        ///
+        ///  @fn    addPosted
+        ///  @brief Counts one posted record. Safe to call from any thread.
+        ///
+        void addPosted();
+
+        ///
+        ///  @fn    addDrained
+        ///  @brief Counts records that were taken off the queue.
+        ///  @param count Amount of records
+        ///
+        void addDrained(qint64 count);
+
+        ///
+        ///  @fn    addFlushLatency
+        ///  @brief Records how long a batch waited to be applied.
+        ///  @param nsecs Duration in nanoseconds
+        ///
+        void addFlushLatency(qint64 nsecs);
+
+        ///
+        ///  @fn    addApplyTime
+        ///  @brief Records how long applying a batch took.
+        ///  @param nsecs Duration in nanoseconds
+        ///
+        void addApplyTime(qint64 nsecs);
+
+        ///
+        ///  @fn    addPaintTime
+        ///  @brief Records how long painting a frame took.
+        ///  @param nsecs Duration in nanoseconds
+        ///
+        void addPaintTime(qint64 nsecs);
+
+        ///
+        ///  @fn    addReadTime
+        ///  @brief Records how long a blocking read waited for input.
+        ///  @param nsecs Duration in nanoseconds
+        ///
+        void addReadTime(qint64 nsecs);
+
+        ///
+        ///  @fn      snapshot
+        ///  @brief   Reads all counters.
+        ///  @returns the counters; the fields that describe the output
+        ///           itself are left at zero for the terminal to fill in.
+        ///  @note    The rates are refreshed at most once per second and
+        ///           are shared by all callers.
+        ///
+        Snapshot snapshot();
+
+
+    private:
+
+        //
+        // Atomic counterpart of Histogram
+        //
+        struct Counters {
+            QAtomicInteger<qint64> buckets[HistogramBuckets];
+            QAtomicInteger<qint64> count;
+            QAtomicInteger<qint64> totalNsecs;
+            QAtomicInteger<qint64> maximumNsecs;
+        };
+
+        static void record(Counters &counters, qint64 nsecs);
+        static Histogram load(const Counters &counters);
+
+        //
+        // Private class members
+        //
+        QAtomicInteger<qint64> m_Characters;
+        QAtomicInteger<qint64> m_Lines;
+        QAtomicInteger<qint64> m_Posted;
+        QAtomicInteger<qint64> m_Drained;
+        QAtomicInteger<qint64> m_Reads;
+        QAtomicInteger<qint64> m_ReadNsecs;
+        Counters m_FlushLatency;
+        Counters m_ApplyTime;
+        Counters m_PaintTime;
+        QElapsedTimer m_RateClock;
+        qint64 m_RateCharacters;
+        qint64 m_RateLines;
+        double m_CharactersPerSecond;
+        double m_LinesPerSecond;
+
+        Q_DISABLE_COPY(QTerminalStats)
+    };
+}
+
+
+#endif  // __KGL_QTERMINALSTATS_HPP__
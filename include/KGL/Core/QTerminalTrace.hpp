@@ -0,0 +1,185 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+#ifndef __KGL_QTERMINALTRACE_HPP__
+#define __KGL_QTERMINALTRACE_HPP__
+
+
+//
+//  Included headers
+//
+#include <KGL/KGLConfig.hpp>
+#include <QAtomicInt>
+#include <QByteArray>
+#include <QString>
+
+
+///
+///  @def   KGL_TRACE_SPAN
+///  @brief Records the rest of the enclosing scope as one span.
+///         Takes the (static) name of the span and optionally a
+///         value, e.g. the amount of characters written.
+///
+#define KGL_TRACE_SPAN(...) ::kgl::QTerminalTrace::Span kglTraceSpan(__VA_ARGS__)
+
+
+namespace kgl {
+
+    ///
+    ///  @file      QTerminalTrace.hpp
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///  @class     QTerminalTrace
+    ///  @brief     Process-wide span tracer that exports Chrome trace-event
+    ///             JSON, e.g. for viewing in Perfetto.
+    ///
+    ///  Every thread records into its own ring buffer, which is created
+    ///  on the thread's first span. Apart from that first span, recording
+    ///  takes no lock and never waits; once a ring is full the oldest
+    ///  spans are overwritten.
+    ///  A ring takes RingCapacity * 32 bytes, 2 MiB, per thread that
+    ///  recorded while it runs. When a thread exits, its newest spans are
+    ///  archived and its ring is reused by the next thread; the archive
+    ///  keeps RingCapacity spans of exited threads at most.
+    ///  While tracing is off, a span costs one relaxed load and one
+    ///  branch. Timestamps are read from the monotonic clock, so they
+    ///  line up with other traces of the same machine.
+    ///
+    class KGL_API QTerminalTrace {
+    public:
+
+        /// Spans kept per thread.
+        static const qint32 RingCapacity = 65536;
+
+        ///
+        ///  @class   Span
+        ///  @brief   Records its own lifetime as a span.
+        ///
+        class KGL_API Span {
+        public:
+
+            ///
+            ///  @fn    Constructor
+            ///  @brief Starts a span if tracing is enabled.
+            ///  @param name Name of the span; must outlive the trace,
+            ///         e.g. a string literal
+            ///  @param value Value shown with the span, -1 for none
+            ///
+            explicit Span(const char *name, qint64 value = -1)
+                : m_Name(isEnabled() ? name : NULL),
+                  m_Value(value),
+                  m_Start(0) {
+                if (m_Name) {
+                    m_Start = now();
+                }
+            }
+
+            ///
+            ///  @fn    Destructor
+            ///  @brief Records the span.
+            ///
+            ~Span() {
+                if (m_Name) {
+                    record(m_Name, m_Start, now() - m_Start, m_Value);
+                }
+            }
+
+        private:
+
+            //
+            // Private class members
+            //
+            const char *m_Name;
+            qint64 m_Value;
+            qint64 m_Start;
+
+            Q_DISABLE_COPY(Span)
+        };
+
+
+        ///
+        ///  @fn      isEnabled
+        ///  @returns true if spans are being recorded.
+        ///
+        static bool isEnabled() {
+            return m_IsEnabled.load() != 0;
+        }
+
+        ///
+        ///  @fn    setEnabled
+        ///  @brief Starts or stops recording spans. Recorded spans are
+        ///         kept until clear() is called.
+        ///  @param enabled True to start recording
+        ///
+        static void setEnabled(bool enabled);
+
+        ///
+        ///  @fn    clear
+        ///  @brief Drops the spans recorded so far.
+        ///  @note  Spans recorded concurrently may survive.
+        ///
+        static void clear();
+
+        ///
+        ///  @fn      toJson
+        ///  @brief   Exports all recorded spans. Safe to call from any
+        ///           thread, also while tracing.
+        ///  @returns a trace-event document in the JSON object format.
+        ///
+        static QByteArray toJson();
+
+        ///
+        ///  @fn      save
+        ///  @brief   Writes the output of toJson() to a file.
+        ///  @param   path File to write
+        ///  @returns false if the file could not be written.
+        ///
+        static bool save(const QString &path);
+
+        ///
+        ///  @fn      now
+        ///  @returns the monotonic clock in nanoseconds.
+        ///
+        static qint64 now();
+
+        ///
+        ///  @fn    record
+        ///  @brief Adds a finished span to the calling thread's ring.
+        ///  @param name Name of the span
+        ///  @param start Start time, see now()
+        ///  @param duration Duration in nanoseconds
+        ///  @param value Value shown with the span, -1 for none
+        ///
+        static void record(const char *name, qint64 start, qint64 duration, qint64 value);
+
+
+    private:
+
+        //
+        // Private class members
+        //
+        static QAtomicInt m_IsEnabled;
+    };
+}
+
+
+#endif  // __KGL_QTERMINALTRACE_HPP__
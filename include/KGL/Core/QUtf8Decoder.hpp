@@ -0,0 +1,98 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+#ifndef __KGL_QUTF8DECODER_HPP__
+#define __KGL_QUTF8DECODER_HPP__
+
+
+//
+//  Included headers
+//
+#include <KGL/KGLConfig.hpp>
+#include <QString>
+
+
+namespace kgl {
+
+    ///
+    ///  @file      QUtf8Decoder.hpp
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///  @class     QUtf8Decoder
+    ///  @brief     Incremental UTF-8 to UTF-16 decoder.
+    ///
+    ///  Sequences may be split across calls; the decoder remembers the
+    ///  incomplete tail of a chunk and completes it with the next one.
+    ///  Runs of ASCII are validated and widened sixteen bytes at a time.
+    ///  Invalid or overlong sequences, surrogates and code points above
+    ///  U+10FFFF decode to U+FFFD.
+    ///
+    class KGL_API QUtf8Decoder {
+    public:
+
+        ///
+        ///  @fn    Default constructor
+        ///  @brief Initializes a new instance of QUtf8Decoder.
+        ///
+        QUtf8Decoder();
+
+
+        ///
+        ///  @fn      hasPendingBytes : const
+        ///  @brief   Determines whether an incomplete sequence is pending.
+        ///  @returns true if the last chunk ended within a sequence.
+        ///
+        bool hasPendingBytes() const;
+
+        ///
+        ///  @fn    reset
+        ///  @brief Drops an incomplete sequence.
+        ///
+        void reset();
+
+        ///
+        ///  @fn    decode
+        ///  @brief Decodes the given bytes and appends them to 'out'.
+        ///  @param data UTF-8 encoded bytes
+        ///  @param length Amount of bytes
+        ///  @param out String to append the characters to
+        ///  @note  Grows 'out' at most once per call.
+        ///
+        void decode(const char *data, qint64 length, QString &out);
+
+
+    private:
+
+        qint32 decodeChunk(const uchar *src, qint32 length, QChar *dst);
+
+        //
+        // Private class members
+        //
+        quint32 m_CodePoint;
+        quint32 m_Minimum;
+        qint32 m_Remaining;
+    };
+}
+
+
+#endif  // __KGL_QUTF8DECODER_HPP__
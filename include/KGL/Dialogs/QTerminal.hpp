@@ -28,13 +28,40 @@
 //  Included headers
 //
 #include <KGL/KGLConfig.hpp>
+#include <KGL/Core/QAnsiParser.hpp>
+#include <KGL/Core/QFloatFormatter.hpp>
+#include <KGL/Core/QFormatString.hpp>
+#include <KGL/Core/QNumberFormatter.hpp>
+#include <KGL/Core/QNumberParser.hpp>
+#include <KGL/Core/QTerminalBuffer.hpp>
+#include <KGL/Core/QTerminalHighlighter.hpp>
+#include <KGL/Core/QTerminalLog.hpp>
+#include <KGL/Core/QTerminalMappedFile.hpp>
+#include <KGL/Core/QTerminalProcess.hpp>
+#include <KGL/Core/QTerminalQueue.hpp>
+#include <KGL/Core/QTerminalRecorder.hpp>
+#include <KGL/Core/QTerminalSearch.hpp>
+#include <KGL/Core/QTerminalStats.hpp>
+#include <KGL/Core/QUtf8Decoder.hpp>
 #include <KGL/Dialogs/QTerminalEnums.hpp>
 #include <KGL/Design/QTerminalDesign.hpp>
+#include <KGL/Widgets/QTerminalSearchBar.hpp>
+#include <KGL/Widgets/QTerminalView.hpp>
 #include <QDialog>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QLabel>
 #include <QMainWindow>
 #include <QMenuBar>
+#include <QPointer>
+#include <QQueue>
+#include <QStringList>
 #include <QTextEdit>
+#include <QTimer>
 #include <QVBoxLayout>
+#include <functional>
+#include <tuple>
+#include <type_traits>
 
 
 namespace kgl {
@@ -50,6 +77,9 @@ namespace kgl {
     Q_OBJECT
     public:
 
+        class Stream;
+
+
         ///
         ///  @fn    Default constructor
         ///  @brief Initializes a new instance of QTerminal.
@@ -76,11 +106,28 @@ namespace kgl {
         ///  @brief Specifies the current terminal state.
         ///  @param state Error, success, warning, ...
         ///  @param highlight True if highlighted text
-        ///  @note  Will generate a format that will be used
-        ///         for all 'write' operations.
+        ///  @note  Selects one of the formats that are prebuilt whenever
+        ///         the design changes; it is used for all 'write' operations.
         ///
         void setCurrentState(TextState state, bool highlight = false);
 
+        ///
+        ///  @fn    setNumberPadding
+        ///  @brief Specifies the minimum width of written integers.
+        ///  @param width Minimum amount of characters, 0 for none
+        ///  @param fill Zero pads the digits, any other character is
+        ///         put in front of the number
+        ///
+        void setNumberPadding(int width, QChar fill = QLatin1Char('0'));
+
+        ///
+        ///  @fn    setDigitGrouping
+        ///  @brief Specifies the character that separates digit groups.
+        ///  @param separator Separator, a null character disables grouping
+        ///  @note  Decimal digits are grouped by three, all others by four.
+        ///
+        void setDigitGrouping(QChar separator);
+
         ///
         ///  @fn      menuAt : const
         ///  @brief   Retrieves the menu at 'index' in order to modify it.
@@ -95,6 +142,302 @@ namespace kgl {
         ///
         void clear();
 
+        ///
+        ///  @fn      flushInterval : const
+        ///  @brief   Retrieves the interval in which pending output is applied.
+        ///  @returns the flush interval in milliseconds.
+        ///
+        int flushInterval() const;
+
+        ///
+        ///  @fn    setFlushInterval
+        ///  @brief Specifies the interval in which pending output is applied.
+        ///  @param msec Interval in milliseconds, 0 to apply it as soon
+        ///         as control returns to the event loop
+        ///  @note  Defaults to 16 milliseconds (one frame at 60 Hz).
+        ///
+        void setFlushInterval(int msec);
+
+        ///
+        ///  @fn      renderBackend : const
+        ///  @brief   Retrieves the backend that displays the output.
+        ///  @returns RenderBackend::Document or RenderBackend::Grid
+        ///
+        RenderBackend renderBackend() const;
+
+        ///
+        ///  @fn    setRenderBackend
+        ///  @brief Specifies the backend that displays the output.
+        ///  @param backend Document (rich text) or Grid (only the visible
+        ///         rows are laid out and painted)
+        ///  @note  The output is kept: the grid shows the buffer as is and
+        ///         the document is rebuilt from it. A pending read continues
+        ///         in the new backend with the text typed so far.
+        ///
+        void setRenderBackend(RenderBackend backend);
+
+        ///
+        ///  @fn      scrollbackLines : const
+        ///  @brief   Retrieves the maximum amount of lines kept.
+        ///  @returns the line limit or 0 if unlimited.
+        ///
+        int scrollbackLines() const;
+
+        ///
+        ///  @fn      scrollbackBytes : const
+        ///  @brief   Retrieves the maximum amount of text memory kept.
+        ///  @returns the byte limit or 0 if unlimited.
+        ///
+        qint64 scrollbackBytes() const;
+
+        ///
+        ///  @fn    setScrollbackLines
+        ///  @brief Limits the amount of lines kept in the console.
+        ///  @param lines Line limit, 0 for unlimited
+        ///  @note  The oldest lines are dropped first. The line that is
+        ///         currently being read is never dropped.
+        ///
+        void setScrollbackLines(int lines);
+
+        ///
+        ///  @fn    setScrollbackBytes
+        ///  @brief Limits the amount of text memory kept in the console.
+        ///  @param bytes Byte limit, 0 for unlimited
+        ///
+        void setScrollbackBytes(qint64 bytes);
+
+        ///
+        ///  @fn      heldBytes : const
+        ///  @brief   Retrieves the memory currently held by the console text.
+        ///  @returns the amount of bytes used by the characters and
+        ///           their style runs in the buffer, plus an estimate of
+        ///           the document that holds the text once more in the
+        ///           Document backend.
+        ///
+        qint64 heldBytes() const;
+
+        ///
+        ///  @fn      evictedLines : const
+        ///  @brief   Retrieves how many lines were dropped from the top.
+        ///  @returns the total amount of evicted lines.
+        ///
+        qint64 evictedLines() const;
+
+        ///
+        ///  @fn      buffer : const
+        ///  @brief   Retrieves the model that holds the console output,
+        ///           the input line and the scrollback limits.
+        ///  @returns the buffer behind all views of the console.
+        ///  @note    Pending output is only part of the buffer after
+        ///           the next flush.
+        ///
+        const QTerminalBuffer &buffer() const;
+
+        ///
+        ///  @fn      createView
+        ///  @brief   Creates another grid view of the console output,
+        ///           e.g. for a split or a second window.
+        ///  @param   parent Parent widget of the view
+        ///  @returns the new view; owned by 'parent' or by the caller.
+        ///  @note    All views share one buffer and follow the design,
+        ///           the formats and the output of the console. While
+        ///           the grid backend reads, any view may edit the line.
+        ///           Views that outlive the console stay empty.
+        ///
+        QTerminalView *createView(QWidget *parent = NULL);
+
+        ///
+        ///  @fn      stats
+        ///  @brief   Reads the performance counters of the terminal.
+        ///  @returns throughput, queue depths, latency histograms, the
+        ///           size of the output and the time spent in reads.
+        ///  @note    The counters are always collected; reading them
+        ///           does not interfere with the output.
+        ///
+        QTerminalStats::Snapshot stats();
+
+        ///
+        ///  @fn      isStatsVisible : const
+        ///  @returns true if the statistics overlay is shown.
+        ///
+        bool isStatsVisible() const;
+
+        ///
+        ///  @fn    openLog
+        ///  @brief Mirrors all further output into a file.
+        ///  @param path File to append to
+        ///  @param encoding Plain text, ANSI SGR sequences or HTML
+        ///  @param maximumSize Size in bytes after which the file is
+        ///         rotated, 0 to never rotate
+        ///  @param maximumFiles Amount of files kept when rotating
+        ///  @note  The file is written on a background thread; a slow
+        ///         disk drops log output but never blocks the console.
+        ///
+        void openLog(const QString &path, LogEncoding encoding = LogEncoding::Plain,
+                     qint64 maximumSize = 0, int maximumFiles = 5);
+
+        ///
+        ///  @fn    closeLog
+        ///  @brief Stops mirroring once the queued output is written.
+        ///
+        void closeLog();
+
+        ///
+        ///  @fn      log : const
+        ///  @brief   Retrieves the log mirror, e.g. to query dropped output.
+        ///  @returns the log or NULL if openLog was never called.
+        ///
+        QTerminalLog *log() const;
+
+        ///
+        ///  @fn      addHighlightRule
+        ///  @brief   Colors text matching 'pattern' in the given state as
+        ///           it is written.
+        ///  @param   pattern Text or regular expression to find
+        ///  @param   state State whose color the matches take
+        ///  @param   syntax Syntax of 'pattern'
+        ///  @param   cs Whether to match case
+        ///  @returns the identifier of the rule or -1 if 'pattern' is
+        ///           empty, an invalid expression or cannot be joined
+        ///           with the other expressions.
+        ///  @note    Matches may span flushes within the last 4096
+        ///           characters of a line; '^' and '$' match at line
+        ///           breaks. All literal rules are matched in one pass;
+        ///           expressions cost more per rule, see
+        ///           QTerminalHighlighter.
+        ///
+        int addHighlightRule(const QString &pattern, TextState state,
+                             PatternSyntax syntax = PatternSyntax::Literal,
+                             Qt::CaseSensitivity cs = Qt::CaseSensitive);
+
+        ///
+        ///  @fn      addHighlightRule
+        ///  @brief   Colors text matching 'pattern' as it is written.
+        ///  @param   pattern Text or regular expression to find
+        ///  @param   color Text color of the matches
+        ///  @param   syntax Syntax of 'pattern'
+        ///  @param   cs Whether to match case
+        ///  @returns the identifier of the rule or -1 if 'pattern' is
+        ///           empty, an invalid expression or cannot be joined
+        ///           with the other expressions.
+        ///
+        int addHighlightRule(const QString &pattern, const QColor &color,
+                             PatternSyntax syntax = PatternSyntax::Literal,
+                             Qt::CaseSensitivity cs = Qt::CaseSensitive);
+
+        ///
+        ///  @fn    removeHighlightRule
+        ///  @brief Stops coloring the matches of a rule in new output.
+        ///  @param id Identifier returned by addHighlightRule
+        ///
+        void removeHighlightRule(int id);
+
+        ///
+        ///  @fn    clearHighlightRules
+        ///  @brief Removes all highlight rules.
+        ///
+        void clearHighlightRules();
+
+        ///
+        ///  @fn      startRecording
+        ///  @brief   Records all further output and input into a session file.
+        ///  @param   path File to create
+        ///  @returns false if the file could not be created.
+        ///  @note    Output is timestamped when it is flushed.
+        ///
+        bool startRecording(const QString &path);
+
+        ///
+        ///  @fn    stopRecording
+        ///  @brief Finishes the session file.
+        ///
+        void stopRecording();
+
+        ///
+        ///  @fn      replay
+        ///  @brief   Plays a recorded session back into the console.
+        ///  @param   path File written by startRecording
+        ///  @param   speed Time factor, e.g. 1 for real time or 10 for
+        ///           ten times as fast; 0 replays as fast as possible
+        ///  @returns false if the file is no session.
+        ///  @note    Emits replayFinished() at the end. Recorded input is
+        ///           shown as text; no read is completed by it.
+        ///
+        bool replay(const QString &path, double speed = 1.0);
+
+        ///
+        ///  @fn    stopReplay
+        ///  @brief Stops a running replay.
+        ///
+        void stopReplay();
+
+        ///
+        ///  @fn      isReplaying : const
+        ///  @brief   Determines whether a replay is running.
+        ///  @returns true if replaying.
+        ///
+        bool isReplaying() const;
+
+        ///
+        ///  @fn      viewFile
+        ///  @brief   Shows a text file, such as a large log, read-only in
+        ///           place of the console output.
+        ///  @param   path File to view
+        ///  @returns false if the file could not be opened.
+        ///  @note    The file is memory-mapped and its lines are found on
+        ///           a background thread; only the visible lines are
+        ///           decoded, so opening is immediate for any file size.
+        ///           ANSI sequences are interpreted per line.
+        ///
+        bool viewFile(const QString &path);
+
+        ///
+        ///  @fn    closeFile
+        ///  @brief Returns from the file view to the console output.
+        ///
+        void closeFile();
+
+        ///
+        ///  @fn      isViewingFile : const
+        ///  @brief   Determines whether a file is shown.
+        ///  @returns true if viewing a file.
+        ///
+        bool isViewingFile() const;
+
+        ///
+        ///  @fn      attachProcess
+        ///  @brief   Runs a child process inside the terminal. Its output
+        ///           is written in the Normal state, or in the Error
+        ///           state for stderr, and every line read from the
+        ///           terminal is forwarded to its standard input.
+        ///  @param   program Program to run; looked up in PATH
+        ///  @param   arguments Arguments passed to the program
+        ///  @param   usePty True to run the child on a pseudo-terminal,
+        ///           which interactive tools need. ANSI sequences are
+        ///           then interpreted and stderr is part of the output.
+        ///           The child is told the size of the output whenever
+        ///           it changes. Only available on Unix.
+        ///  @returns false if a process is attached already or the
+        ///           program could not be started.
+        ///  @note    Output is read on a background thread and applied
+        ///           once per frame. When the terminal falls behind, the
+        ///           child is blocked in its writes instead.
+        ///
+        bool attachProcess(const QString &program, const QStringList &arguments = QStringList(), bool usePty = false);
+
+        ///
+        ///  @fn    detachProcess
+        ///  @brief Kills the attached child process.
+        ///
+        void detachProcess();
+
+        ///
+        ///  @fn      isProcessAttached : const
+        ///  @brief   Determines whether a child process is attached.
+        ///  @returns true if attached.
+        ///
+        bool isProcessAttached() const;
+
 
         ///
         ///  @fn      readLine : const
@@ -149,6 +492,22 @@ namespace kgl {
         ///
         quint64 readUInt64();
 
+        ///
+        ///  @fn      readInt32 : const
+        ///  @brief   Blocks until one signed integer was typed.
+        ///  @returns the integer typed into the console.
+        ///  @note    Displays an error message if parsing was invalid.
+        ///
+        qint32 readInt32();
+
+        ///
+        ///  @fn      readInt64 : const
+        ///  @brief   Blocks until one signed long was typed.
+        ///  @returns the long typed into the console.
+        ///  @note    Displays an error message if parsing was invalid.
+        ///
+        qint64 readInt64();
+
         ///
         ///  @fn      readFloat : const
         ///  @brief   Blocks until one float was typed.
@@ -175,6 +534,121 @@ namespace kgl {
         quint64 readHex();
 
 
+        ///
+        ///  @fn    readLineAsync
+        ///  @brief Reads one line without blocking the caller.
+        ///  @param callback Receives the line once return was pressed
+        ///  @note  The callback is invoked from the event loop, never from
+        ///         within the key event. Reads are served in the order
+        ///         they were requested, blocking ones included.
+        ///
+        void readLineAsync(const std::function<void(const QString &)> &callback);
+
+        ///
+        ///  @fn    readCharAsync
+        ///  @brief Reads one character without blocking the caller.
+        ///  @param callback Receives the first character of the line
+        ///
+        void readCharAsync(const std::function<void(QChar)> &callback);
+
+        ///
+        ///  @fn    readStringAsync
+        ///  @brief Reads a string of specified size without blocking the caller.
+        ///  @param size Maximum size of the string
+        ///  @param callback Receives the trimmed string
+        ///
+        void readStringAsync(quint32 size, const std::function<void(const QString &)> &callback);
+
+        ///
+        ///  @fn    readByteAsync
+        ///  @brief Reads one byte without blocking the caller.
+        ///  @param callback Receives the parsed byte
+        ///  @note  Displays an error message and sets the flag if parsing
+        ///         was invalid, before the callback is invoked.
+        ///
+        void readByteAsync(const std::function<void(quint8)> &callback);
+
+        ///
+        ///  @fn    readUInt16Async
+        ///  @brief Reads one short without blocking the caller.
+        ///  @param callback Receives the parsed short
+        ///
+        void readUInt16Async(const std::function<void(quint16)> &callback);
+
+        ///
+        ///  @fn    readUInt32Async
+        ///  @brief Reads one integer without blocking the caller.
+        ///  @param callback Receives the parsed integer
+        ///
+        void readUInt32Async(const std::function<void(quint32)> &callback);
+
+        ///
+        ///  @fn    readUInt64Async
+        ///  @brief Reads one long without blocking the caller.
+        ///  @param callback Receives the parsed long
+        ///
+        void readUInt64Async(const std::function<void(quint64)> &callback);
+
+        ///
+        ///  @fn    readInt32Async
+        ///  @brief Reads one signed integer without blocking the caller.
+        ///  @param callback Receives the parsed integer
+        ///
+        void readInt32Async(const std::function<void(qint32)> &callback);
+
+        ///
+        ///  @fn    readInt64Async
+        ///  @brief Reads one signed long without blocking the caller.
+        ///  @param callback Receives the parsed long
+        ///
+        void readInt64Async(const std::function<void(qint64)> &callback);
+
+        ///
+        ///  @fn    readFloatAsync
+        ///  @brief Reads one float without blocking the caller.
+        ///  @param callback Receives the parsed float
+        ///
+        void readFloatAsync(const std::function<void(float)> &callback);
+
+        ///
+        ///  @fn    readDoubleAsync
+        ///  @brief Reads one double without blocking the caller.
+        ///  @param callback Receives the parsed double
+        ///
+        void readDoubleAsync(const std::function<void(double)> &callback);
+
+        ///
+        ///  @fn    readHexAsync
+        ///  @brief Reads one hexadecimal number without blocking the caller.
+        ///  @param callback Receives the parsed number
+        ///
+        void readHexAsync(const std::function<void(quint64)> &callback);
+
+        ///
+        ///  @fn      readValues
+        ///  @brief   Blocks until one line of values was typed.
+        ///  @param   f Base of integers without prefix
+        ///  @returns one value of every type in T, in the order typed.
+        ///  @note    Values are separated by blanks, commas, semicolons or
+        ///           line breaks, so a pasted block is read at once. Every
+        ///           missing or invalid field is reported and yields a
+        ///           default-constructed value; flag() tells the worst one.
+        ///           With C++17: auto [a, b] = readValues<quint8, double>();
+        ///
+        template <typename... T>
+        std::tuple<T...> readValues(NumberFormat f = NumberFormat::Decimal);
+
+        ///
+        ///  @fn      readArray
+        ///  @brief   Blocks until one line of values was typed.
+        ///  @param   f Base of integers without prefix
+        ///  @returns all values typed, in order.
+        ///  @note    Separators and error reporting as in readValues.
+        ///
+        template <typename T>
+        QVector<T> readArray(NumberFormat f = NumberFormat::Decimal);
+
+
         ///
         ///  @fn    writeChar : const
         ///  @brief Writes one character to the console.
@@ -196,6 +670,59 @@ namespace kgl {
         ///
         void writeString(const QString &s);
 
+        ///
+        ///  @fn      stream
+        ///  @brief   Starts a statement of mixed items.
+        ///  @returns a stream that writes its items once it is destroyed.
+        ///  @note    Equivalent to 'terminal << item'.
+        ///
+        Stream stream();
+
+        ///
+        ///  @fn    writeFormatted
+        ///  @brief Writes a format string with its arguments filled in.
+        ///  @param format UTF-8 format string, see QFormatString
+        ///  @param args One argument per placeholder
+        ///  @note  Formats straight into the pending output. Use the
+        ///         KGL_WRITE_FORMATTED macro to have the format string
+        ///         checked against the arguments at compile time; here,
+        ///         placeholders that do not fit are written literally.
+        ///
+        template <typename... A>
+        void writeFormatted(const char *format, const A &... args);
+
+        ///
+        ///  @fn    writeAnsi
+        ///  @brief Writes a string that may contain ANSI SGR sequences.
+        ///  @param s String to write
+        ///  @note  Red, green, yellow and the default color use the error,
+        ///         success, warning and text colors of the design; all
+        ///         other 16, 256 and true colors are taken literally.
+        ///         Bold, underline and inverse (shown highlighted) are
+        ///         supported too. The selected attributes carry over to
+        ///         the next call but do not affect the other 'write'
+        ///         operations. Other escape sequences are swallowed.
+        ///
+        void writeAnsi(const QString &s);
+
+        ///
+        ///  @fn    writeBytes
+        ///  @brief Writes UTF-8 encoded bytes to the console.
+        ///  @param data Bytes to write
+        ///  @param length Amount of bytes
+        ///  @note  A sequence that is split between two calls is
+        ///         completed by the second one. The bytes are decoded
+        ///         straight into the pending output.
+        ///
+        void writeBytes(const char *data, qint64 length);
+
+        ///
+        ///  @fn    writeBytes
+        ///  @brief Writes UTF-8 encoded bytes to the console.
+        ///  @param bytes Bytes to write
+        ///
+        void writeBytes(const QByteArray &bytes);
+
         ///
         ///  @fn    writeByte : const
         ///  @brief Writes a byte to the console.
@@ -228,27 +755,235 @@ namespace kgl {
         ///
         void writeUInt64(quint64 b, NumberFormat f = NumberFormat::Decimal);
 
+        ///
+        ///  @fn    writeUInt8s
+        ///  @brief Writes an array of bytes to the console.
+        ///  @param values Bytes to write
+        ///  @param count Amount of bytes
+        ///  @param f Format to use
+        ///  @param separator String between two values
+        ///
+        void writeUInt8s(const quint8 *values, qint32 count,
+                         NumberFormat f = NumberFormat::Decimal,
+                         const QString &separator = " ");
+
+        ///
+        ///  @fn    writeUInt16s
+        ///  @brief Writes an array of shorts to the console.
+        ///  @param values Shorts to write
+        ///  @param count Amount of shorts
+        ///  @param f Format to use
+        ///  @param separator String between two values
+        ///
+        void writeUInt16s(const quint16 *values, qint32 count,
+                          NumberFormat f = NumberFormat::Decimal,
+                          const QString &separator = " ");
+
+        ///
+        ///  @fn    writeUInt32s
+        ///  @brief Writes an array of integers to the console.
+        ///  @param values Integers to write
+        ///  @param count Amount of integers
+        ///  @param f Format to use
+        ///  @param separator String between two values
+        ///
+        void writeUInt32s(const quint32 *values, qint32 count,
+                          NumberFormat f = NumberFormat::Decimal,
+                          const QString &separator = " ");
+
+        ///
+        ///  @fn    writeUInt64s
+        ///  @brief Writes an array of longs to the console.
+        ///  @param values Longs to write
+        ///  @param count Amount of longs
+        ///  @param f Format to use
+        ///  @param separator String between two values
+        ///
+        void writeUInt64s(const quint64 *values, qint32 count,
+                          NumberFormat f = NumberFormat::Decimal,
+                          const QString &separator = " ");
+
         ///
         ///  @fn    writeFloat : const
         ///  @brief Writes a float to the console.
         ///  @param b Float to write
         ///  @param f Format to use
+        ///  @param precision Digits after the decimal point; ignored
+        ///         by FloatFormat::Shortest
+        ///  @note  The shortest format prints the fewest digits that read
+        ///         back as the same float.
         ///
-        void writeFloat(float b);
+        void writeFloat(float b, FloatFormat f = FloatFormat::Shortest, int precision = 6);
 
         ///
         ///  @fn    writeDouble : const
         ///  @brief Writes a double to the console.
         ///  @param b Double to write
         ///  @param f Format to use
+        ///  @param precision Digits after the decimal point; ignored
+        ///         by FloatFormat::Shortest
+        ///  @note  The shortest format prints the fewest digits that read
+        ///         back as the same double.
         ///
-        void writeDouble(double b);
+        void writeDouble(double b, FloatFormat f = FloatFormat::Shortest, int precision = 6);
+
+        ///
+        ///  @fn    writeFloats
+        ///  @brief Writes an array of floats to the console.
+        ///  @param values Floats to write
+        ///  @param count Amount of floats
+        ///  @param f Format to use
+        ///  @param precision Digits after the decimal point
+        ///  @param separator String between two values
+        ///
+        void writeFloats(const float *values, qint32 count,
+                         FloatFormat f = FloatFormat::Shortest, int precision = 6,
+                         const QString &separator = " ");
+
+        ///
+        ///  @fn    writeDoubles
+        ///  @brief Writes an array of doubles to the console.
+        ///  @param values Doubles to write
+        ///  @param count Amount of doubles
+        ///  @param f Format to use
+        ///  @param precision Digits after the decimal point
+        ///  @param separator String between two values
+        ///
+        void writeDoubles(const double *values, qint32 count,
+                          FloatFormat f = FloatFormat::Shortest, int precision = 6,
+                          const QString &separator = " ");
+
+
+        ///
+        ///  @fn    post
+        ///  @brief Writes a string to the console from any thread.
+        ///  @param s String to write
+        ///  @param state Format of the string
+        ///  @param highlight True if highlighted text
+        ///  @note  Thread-safe. The string is queued without locking and
+        ///         applied by the GUI thread in batches. Strings posted
+        ///         by one thread keep their order.
+        ///
+        void post(const QString &s, TextState state = TextState::Normal, bool highlight = false);
+
+
+    signals:
+
+        ///
+        ///  @fn    replayFinished
+        ///  @brief Emitted once a replay reached the end of the session.
+        ///
+        void replayFinished();
+
+        ///
+        ///  @fn    processFinished
+        ///  @brief Emitted once the attached process exited and all of
+        ///         its output was written.
+        ///  @param exitCode Exit code, or 128 plus the signal number
+        ///
+        void processFinished(int exitCode);
+
+
+    public slots:
+
+        ///
+        ///  @fn    flush
+        ///  @brief Applies all pending output to the console immediately.
+        ///  @note  All 'write' operations are buffered and applied in one
+        ///         batched edit per flush interval. Call this if the text
+        ///         needs to be visible right away.
+        ///
+        void flush();
+
+        ///
+        ///  @fn    showSearchBar
+        ///  @brief Shows the search bar (Ctrl+F) below the output.
+        ///  @note  The output is searched on a worker thread; matches in
+        ///         output written later are found as it arrives.
+        ///
+        void showSearchBar();
+
+        ///
+        ///  @fn    findNext
+        ///  @brief Scrolls to the next match of the search.
+        ///
+        void findNext();
+
+        ///
+        ///  @fn    findPrevious
+        ///  @brief Scrolls to the previous match of the search.
+        ///
+        void findPrevious();
+
+        ///
+        ///  @fn    setStatsVisible
+        ///  @brief Shows or hides the statistics overlay, which is
+        ///         refreshed once per second.
+        ///  @param visible True to show the overlay
+        ///
+        void setStatsVisible(bool visible);
 
 
     protected:
 
         QString menuStyleSheet();
+        QString &pendingText();
+        void applyPending();
+        qint64 outputLines() const;
+        QTextCharFormat createFormat(TextState state, bool highlight) const;
+        QTextCharFormat createFormat(const QAnsiParser::Attributes &attributes) const;
+        static quint16 styleIndex(TextState state, bool highlight);
+        quint16 styleIndex(const QAnsiParser::Attributes &attributes);
+        void updateFormats();
+        void trimDocument();
+        void rebuildDocument();
+        QList<QTerminalView *> bufferViews() const;
+        void showOutput();
+        void forwardInput();
+        void finishProcess();
+        void updateWindowSize();
+        void highlightPending();
+        void restyleOpenLine(qint32 start, qint32 length, quint16 style);
+        void searchNewLines();
+        qint64 firstVisibleLine() const;
+        void findMatch(bool backwards);
+        void showMatch(const QTerminalSearch::Match &match);
+        QAnsiParser::Attributes attributesOf(quint16 style) const;
         QString readPrivate();
+        void writeFormattedPrivate(const char *format, const QFormatArgument *args, qint32 count);
+        void appendArgument(QString &out, const QFormatArgument &arg, const QFormatString::Spec &spec);
+        void enqueueRead(const std::function<void(const QString &)> &callback);
+        void beginRead();
+        template <typename T>
+        T parseInteger(const QString &s, NumberFormat f, const char *kind, const char *range);
+        void diagnoseInput(TextState state, const QString &message);
+        void diagnoseField(qint32 index, QNumberParser::Status status);
+        static bool nextField(const QString &s, qint32 &position, qint32 &start, qint32 &length);
+        template <typename T>
+        static typename std::enable_if<std::is_integral<T>::value, QNumberParser::Status>::type
+        parseValue(const QChar *data, qint32 length, NumberFormat f, T &value);
+        static QNumberParser::Status parseValue(const QChar *data, qint32 length, NumberFormat f, float &value);
+        static QNumberParser::Status parseValue(const QChar *data, qint32 length, NumberFormat f, double &value);
+        static QNumberParser::Status parseValue(const QChar *data, qint32 length, NumberFormat f, QChar &value);
+        static QNumberParser::Status parseValue(const QChar *data, qint32 length, NumberFormat f, QString &value);
+        template <typename T>
+        void parseField(const QString &s, qint32 &position, qint32 index, NumberFormat f, T &value);
+        template <std::size_t I, typename... T>
+        typename std::enable_if<I == sizeof...(T)>::type
+        parseFields(const QString &s, qint32 &position, NumberFormat f, std::tuple<T...> &values);
+        template <std::size_t I, typename... T>
+        typename std::enable_if<I < sizeof...(T)>::type
+        parseFields(const QString &s, qint32 &position, NumberFormat f, std::tuple<T...> &values);
+        QChar parseChar(const QString &s);
+        quint8 parseByte(const QString &s);
+        quint16 parseUInt16(const QString &s);
+        quint32 parseUInt32(const QString &s);
+        quint64 parseUInt64(const QString &s);
+        qint32 parseInt32(const QString &s);
+        qint64 parseInt64(const QString &s);
+        float parseFloat(const QString &s);
+        double parseDouble(const QString &s);
+        quint64 parseHex(const QString &s);
         void updateDesign();
         bool eventFilter(QObject *o, QEvent *e);
 
@@ -273,21 +1008,151 @@ namespace kgl {
         ///
         void showFontEditor();
 
+        ///
+        ///  @fn    completeRead
+        ///  @brief Hands the typed line to the oldest read request.
+        ///
+        void completeRead();
+
+        ///
+        ///  @fn    drainQueue
+        ///  @brief Moves posted strings into the pending output.
+        ///
+        void drainQueue();
+
+        ///
+        ///  @fn    replayNext
+        ///  @brief Writes the recorded events that are due.
+        ///
+        void replayNext();
+
+        ///
+        ///  @fn    updateFileView
+        ///  @brief Shows the lines indexed since the last update.
+        ///
+        void updateFileView();
+
+        ///
+        ///  @fn    readProcess
+        ///  @brief Writes the output the child produced since the last
+        ///         call, unless the terminal is still behind.
+        ///
+        void readProcess();
+
+        ///
+        ///  @fn    searchFor
+        ///  @brief Restarts the search with a new pattern.
+        ///
+        void searchFor(const QString &pattern, bool isRegex, bool caseSensitive);
+
+        ///
+        ///  @fn    hideSearchBar
+        ///  @brief Stops searching once the bar was closed.
+        ///
+        void hideSearchBar();
+
+        ///
+        ///  @fn    updateSearch
+        ///  @brief Shows the matches found since the last update.
+        ///
+        void updateSearch();
+
+        ///
+        ///  @fn    updateSearchHighlights
+        ///  @brief Highlights the matches within the visible blocks.
+        ///
+        void updateSearchHighlights();
+
+        ///
+        ///  @fn    updateStatsOverlay
+        ///  @brief Shows the current counters in the overlay.
+        ///
+        void updateStatsOverlay();
+
+        ///
+        ///  @fn    updateViews
+        ///  @brief Adapts all grid views to the current buffer.
+        ///
+        void updateViews();
+
 
     private:
 
+        //
+        // Output that has not been applied to the document yet
+        //
+        struct PendingRun {
+            QString text;
+            quint16 style;
+        };
+
+        //
+        // Feeds interpreted ANSI output into the pending runs
+        //
+        struct AnsiHandler;
+
+        //
+        // Input box that reports the duration of every painted frame
+        //
+        struct InputEdit;
+
         //
         // Private class members
         //
         QTerminalDesign m_Design;
+        QTerminalBuffer m_Buffer;
         QVBoxLayout *m_Layout;
         QTextEdit *m_Input;
+        QTerminalView *m_View;
+        QTerminalView *m_FileView;
+        QList<QPointer<QTerminalView>> m_Views;
+        QTerminalLog *m_Log;
+        QTerminalRecorder *m_Recorder;
+        QTerminalReplay *m_Replay;
+        QTimer *m_ReplayTimer;
+        QTerminalMappedFile *m_MappedFile;
+        QTimer *m_IndexTimer;
+        QTerminalSearch *m_Search;
+        QTerminalSearchBar *m_SearchBar;
+        QTerminalProcess *m_Process;
+        QLabel *m_StatsOverlay;
+        QTimer *m_StatsTimer;
+        QAction *m_StatsAction;
         QMenuBar *m_Menu;
+        QTimer *m_FlushTimer;
+        QTerminalQueue m_Queue;
+        QTerminalStats m_Stats;
+        QAtomicInt m_IsDrainQueued;
+        QAtomicInt m_IsSearchQueued;
+        QAtomicInt m_IsProcessQueued;
+        QQueue<std::function<void(const QString &)>> m_Reads;
+        QVector<PendingRun> m_Pending;
+        QVector<QTextCharFormat> m_Formats;
+        QVector<QAnsiParser::Attributes> m_CustomStyles;
+        QHash<quint64, quint16> m_CustomStyleIndices;
+        QAnsiParser m_Ansi;
+        QTerminalHighlighter m_Highlighter;
+        QUtf8Decoder m_Utf8;
+        QUtf8Decoder m_ProcessOutput;
+        QUtf8Decoder m_ProcessError;
+        QNumberFormatter::Options m_Number;
+        QTerminalReplay::Event m_ReplayEvent;
+        QTerminalSearch::Match m_Match;
+        QElapsedTimer m_ReplayClock;
+        QElapsedTimer m_BatchClock;
+        double m_ReplaySpeed;
         TextState m_Flag;
+        RenderBackend m_Backend;
+        qint64 m_EvictedLines;
+        qint64 m_SearchLine;
         qint32 m_CaretPos;
         qint32 m_InitialPos;
-        bool m_IsReturnPressed;
+        quint16 m_Style;
         bool m_IsReading;
+        bool m_HasReplayEvent;
+        bool m_HasMatch;
+        bool m_IsProcessPaused;
+        bool m_IsForwardQueued;
 
         // Stylesheet for the menu-bar
         const QString m_MenuSheet =
@@ -305,7 +1170,271 @@ namespace kgl {
                 "   background-color: #%pc;"
                 "}";
     };
+
+
+    ///
+    ///  @class     Stream
+    ///  @brief     Collects the items of one statement and writes
+    ///             them to the terminal once the statement ends.
+    ///
+    ///  Strings, characters, byte arrays (UTF-8), booleans and all
+    ///  arithmetic types are accepted; the overload is picked at
+    ///  compile time. TextState, Highlight, NumberFormat and
+    ///  FloatFormat values act as manipulators for the rest of the
+    ///  statement and do not change the terminal's own state.
+    ///
+    ///  terminal << TextState::Error << "code " << NumberFormat::Hexadecimal << 255u;
+    ///
+    class KGL_API QTerminal::Stream {
+    public:
+
+        ///
+        ///  @fn    Constructor
+        ///  @brief Starts a statement on 'terminal'.
+        ///  @param terminal Terminal to write to
+        ///
+        explicit Stream(QTerminal *terminal);
+
+        ///
+        ///  @fn    Move constructor
+        ///  @brief Takes over the collected items of 'other'.
+        ///  @param other Stream to take over
+        ///
+        Stream(Stream &&other);
+
+        ///
+        ///  @fn    Destructor
+        ///  @brief Writes all collected items to the terminal.
+        ///
+        ~Stream();
+
+        ///
+        ///  @fn      precision
+        ///  @brief   Specifies the digits after the decimal point of fixed
+        ///           and scientific floating-point numbers.
+        ///  @param   digits Amount of digits, 6 by default
+        ///  @returns this stream.
+        ///
+        Stream &precision(int digits);
+
+
+        Stream &operator<<(const QString &s);
+        Stream &operator<<(const QLatin1String &s);
+        Stream &operator<<(const char *s);
+        Stream &operator<<(const QByteArray &bytes);
+        Stream &operator<<(QChar c);
+        Stream &operator<<(char c);
+        Stream &operator<<(bool b);
+        Stream &operator<<(TextState state);
+        Stream &operator<<(Highlight highlight);
+        Stream &operator<<(NumberFormat f);
+        Stream &operator<<(FloatFormat f);
+
+        template <typename T>
+        typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, Stream &>::type
+        operator<<(T value);
+
+        template <typename T>
+        typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value, Stream &>::type
+        operator<<(T value);
+
+        template <typename T>
+        typename std::enable_if<std::is_floating_point<T>::value, Stream &>::type
+        operator<<(T value);
+
+
+    private:
+
+        void setStyle(quint16 style);
+
+        //
+        // Private class members
+        //
+        QTerminal *m_Terminal;
+        QVector<PendingRun> m_Runs;
+        QString m_Text;
+        QNumberFormatter::Options m_Number;
+        FloatFormat m_Float;
+        qint32 m_Precision;
+        TextState m_State;
+        quint16 m_Style;
+        bool m_Highlight;
+
+        Q_DISABLE_COPY(Stream)
+    };
+
+
+    ///
+    ///  @fn      operator<<
+    ///  @brief   Starts a statement of mixed items on 'terminal'.
+    ///  @param   terminal Terminal to write to
+    ///  @param   value First item of the statement
+    ///  @returns a stream that writes its items once the statement ends.
+    ///
+    template <typename T>
+    QTerminal::Stream operator<<(QTerminal &terminal, const T &value) {
+        QTerminal::Stream stream(&terminal);
+        stream << value;
+        return stream;
+    }
+
+    ///
+    ///  @fn        operator<<
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, QTerminal::Stream &>::type
+    QTerminal::Stream::operator<<(T value) {
+        QNumberFormatter::append(static_cast<qint64>(value), m_Number, m_Text);
+        return *this;
+    }
+
+    ///
+    ///  @fn        operator<<
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value, QTerminal::Stream &>::type
+    QTerminal::Stream::operator<<(T value) {
+        QNumberFormatter::append(static_cast<quint64>(value), m_Number, m_Text);
+        return *this;
+    }
+
+    ///
+    ///  @fn        operator<<
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<T>::value, QTerminal::Stream &>::type
+    QTerminal::Stream::operator<<(T value) {
+        // Long doubles are printed with double precision
+        typedef typename std::conditional<std::is_same<T, float>::value, float, double>::type Narrowed;
+        QFloatFormatter::append(static_cast<Narrowed>(value), m_Float, m_Precision, m_Text);
+        return *this;
+    }
+
+
+    ///
+    ///  @fn        writeFormatted
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    template <typename... A>
+    void QTerminal::writeFormatted(const char *format, const A &... args) {
+        const QFormatArgument list[] = { QFormatArgument(args)..., QFormatArgument(false) };
+        writeFormattedPrivate(format, list, qint32(sizeof...(A)));
+    }
+
+    ///
+    ///  @fn        readValues
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    template <typename... T>
+    std::tuple<T...> QTerminal::readValues(NumberFormat f) {
+        const QString line = readPrivate();
+        std::tuple<T...> values;
+        qint32 position = 0;
+
+        m_Flag = TextState::Success;
+        parseFields<0>(line, position, f, values);
+
+        // Reports surplus values without failing the read
+        qint32 start, length;
+        if (nextField(line, position, start, length))
+            diagnoseInput(TextState::Warning, QString("Entered text holds more than %1 values.").arg(sizeof...(T)));
+
+        return values;
+    }
+
+    ///
+    ///  @fn        readArray
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    template <typename T>
+    QVector<T> QTerminal::readArray(NumberFormat f) {
+        const QString line = readPrivate();
+        QVector<T> values;
+        qint32 position = 0;
+        qint32 start, length;
+
+        m_Flag = TextState::Success;
+        while (nextField(line, position, start, length)) {
+            T value = T();
+            diagnoseField(values.size(), parseValue(line.constData() + start, length, f, value));
+            values.append(value);
+        }
+
+        return values;
+    }
+
+    ///
+    ///  @fn        parseValue
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value, QNumberParser::Status>::type
+    QTerminal::parseValue(const QChar *data, qint32 length, NumberFormat f, T &value) {
+        return QNumberParser::parse(data, length, f, value);
+    }
+
+    ///
+    ///  @fn        parseField
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    template <typename T>
+    void QTerminal::parseField(const QString &s, qint32 &position, qint32 index, NumberFormat f, T &value) {
+        qint32 start, length;
+        if (nextField(s, position, start, length)) {
+            diagnoseField(index, parseValue(s.constData() + start, length, f, value));
+        } else {
+            diagnoseInput(TextState::Error, QString("Entered value %1 is missing.").arg(index + 1));
+        }
+    }
+
+    ///
+    ///  @fn        parseFields
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    template <std::size_t I, typename... T>
+    typename std::enable_if<I == sizeof...(T)>::type
+    QTerminal::parseFields(const QString &, qint32 &, NumberFormat, std::tuple<T...> &) {
+    }
+
+    ///
+    ///  @fn        parseFields
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    template <std::size_t I, typename... T>
+    typename std::enable_if<I < sizeof...(T)>::type
+    QTerminal::parseFields(const QString &s, qint32 &position, NumberFormat f, std::tuple<T...> &values) {
+        parseField(s, position, qint32(I), f, std::get<I>(values));
+        parseFields<I + 1>(s, position, f, values);
+    }
 }
 
 
+///
+///  @def       KGL_WRITE_FORMATTED
+///  @brief     Calls QTerminal::writeFormatted after checking the format
+///             string against the argument types at compile time.
+///
+///  KGL_WRITE_FORMATTED(terminal, "{!error}{:x}{!} failed", code);
+///
+#define KGL_WRITE_FORMATTED(terminal, format, ...)                                  \
+    do {                                                                            \
+        static_assert(decltype(::kgl::formatTypes(__VA_ARGS__))::validate(format),  \
+                      "Format string does not match its arguments.");               \
+        (terminal).writeFormatted(format, ##__VA_ARGS__);                           \
+    } while (0)
+
+
 #endif  // __KGL_QTERMINAL_HPP__
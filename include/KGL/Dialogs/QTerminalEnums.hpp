@@ -40,12 +40,39 @@ namespace kgl {
         Binary
     };
 
+    enum class FloatFormat {
+        Shortest,
+        Fixed,
+        Scientific
+    };
+
+    enum class Highlight {
+        Off,
+        On
+    };
+
     enum class TextState {
         Normal,
         Error,
         Success,
         Warning
     };
+
+    enum class LogEncoding {
+        Plain,
+        Ansi,
+        Html
+    };
+
+    enum class RenderBackend {
+        Document,
+        Grid
+    };
+
+    enum class PatternSyntax {
+        Literal,
+        RegularExpression
+    };
 }
 
 
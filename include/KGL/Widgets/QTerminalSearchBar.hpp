@@ -0,0 +1,139 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+
+#ifndef __KGL_QTERMINALSEARCHBAR_HPP__
+#define __KGL_QTERMINALSEARCHBAR_HPP__
+
+
+//
+//  Included headers
+//
+#include <KGL/KGLConfig.hpp>
+#include <QCheckBox>
+#include <QLabel>
+#include <QLineEdit>
+#include <QWidget>
+
+
+namespace kgl {
+
+    ///
+    ///  @file      QTerminalSearchBar.hpp
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///  @class     QTerminalSearchBar
+    ///  @brief     Input row for searching the terminal output.
+    ///
+    ///  Return finds the next match, Shift+Return the previous one and
+    ///  Escape closes the bar. The bar only reports what the user did;
+    ///  the terminal performs the search.
+    ///
+    class KGL_API QTerminalSearchBar : public QWidget {
+    Q_OBJECT
+    public:
+
+        ///
+        ///  @fn    Default constructor
+        ///  @brief Initializes a new instance of QTerminalSearchBar.
+        ///  @param parent Parent widget
+        ///
+        QTerminalSearchBar(QWidget *parent = NULL);
+
+        ///
+        ///  @fn    Destructor
+        ///  @brief Frees all resources allocated by QTerminalSearchBar.
+        ///
+        ~QTerminalSearchBar();
+
+
+        ///
+        ///  @fn    activate
+        ///  @brief Shows the bar and selects the pattern for editing.
+        ///
+        void activate();
+
+        ///
+        ///  @fn    setStatus
+        ///  @brief Shows the position of the current match.
+        ///  @param current Zero-based index of the current match, -1 if none
+        ///  @param count Amount of matches found so far
+        ///  @param isValid False if the pattern is an invalid expression
+        ///
+        void setStatus(qint32 current, qint32 count, bool isValid);
+
+
+    signals:
+
+        ///
+        ///  @fn    patternChanged
+        ///  @brief Emitted when the pattern or an option was edited.
+        ///  @param pattern Text or regular expression to find
+        ///  @param isRegex True if 'pattern' is a regular expression
+        ///  @param caseSensitive True to match case
+        ///
+        void patternChanged(const QString &pattern, bool isRegex, bool caseSensitive);
+
+        ///
+        ///  @fn    findNext
+        ///  @brief Emitted to jump to the next match.
+        ///
+        void findNext();
+
+        ///
+        ///  @fn    findPrevious
+        ///  @brief Emitted to jump to the previous match.
+        ///
+        void findPrevious();
+
+        ///
+        ///  @fn    closed
+        ///  @brief Emitted when the bar was hidden by the user.
+        ///
+        void closed();
+
+
+    protected:
+
+        bool eventFilter(QObject *o, QEvent *e);
+
+
+    private slots:
+
+        void emitPatternChanged();
+
+
+    private:
+
+        //
+        // Private class members
+        //
+        QLineEdit *m_Pattern;
+        QCheckBox *m_IsRegex;
+        QCheckBox *m_CaseSensitive;
+        QLabel *m_Status;
+    };
+}
+
+
+#endif  // __KGL_QTERMINALSEARCHBAR_HPP__
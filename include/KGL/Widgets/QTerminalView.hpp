@@ -0,0 +1,200 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+#ifndef __KGL_QTERMINALVIEW_HPP__
+#define __KGL_QTERMINALVIEW_HPP__
+
+
+//
+//  Included headers
+//
+#include <KGL/KGLConfig.hpp>
+#include <KGL/Core/QTerminalBuffer.hpp>
+#include <KGL/Core/QTerminalLineSource.hpp>
+#include <KGL/Core/QTerminalSearch.hpp>
+#include <KGL/Core/QTerminalStats.hpp>
+#include <KGL/Design/QTerminalDesign.hpp>
+#include <QAbstractScrollArea>
+#include <QTextCharFormat>
+
+
+namespace kgl {
+
+    ///
+    ///  @file      QTerminalView.hpp
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///  @class     QTerminalView
+    ///  @brief     Paints terminal lines as a grid of monospace cells.
+    ///
+    ///  Only the rows that intersect the viewport are laid out and
+    ///  painted, so the cost of a frame does not depend on the amount
+    ///  of scrollback. If the view shows a QTerminalBuffer, it also
+    ///  edits the input line of that buffer while it is reading and
+    ///  draws it behind the last line.
+    ///
+    class KGL_API QTerminalView : public QAbstractScrollArea {
+    Q_OBJECT
+    public:
+
+        ///
+        ///  @fn    Default constructor
+        ///  @brief Initializes a new instance of QTerminalView.
+        ///  @param parent Parent widget
+        ///
+        QTerminalView(QWidget *parent = NULL);
+
+        ///
+        ///  @fn    Destructor
+        ///  @brief Frees all resources allocated by QTerminalView.
+        ///
+        ~QTerminalView();
+
+
+        ///
+        ///  @fn    setSource
+        ///  @brief Specifies the read-only lines to display.
+        ///  @param source Buffer or file that outlives the view
+        ///
+        void setSource(const QTerminalLineSource *source);
+
+        ///
+        ///  @fn    setBuffer
+        ///  @brief Displays a buffer and edits its input line.
+        ///  @param buffer Buffer that outlives the view
+        ///  @note  Several views may share one buffer.
+        ///
+        void setBuffer(QTerminalBuffer *buffer);
+
+        ///
+        ///  @fn    setFollowOutput
+        ///  @brief Specifies whether new lines scroll the view down if
+        ///         it is at the bottom. Enabled by default.
+        ///  @param follow True to stick to the bottom
+        ///
+        void setFollowOutput(bool follow);
+
+        ///
+        ///  @fn    setDesign
+        ///  @brief Specifies the colors and the font to paint with.
+        ///  @param design Terminal design
+        ///
+        void setDesign(const QTerminalDesign &design);
+
+        ///
+        ///  @fn    setFormats
+        ///  @brief Specifies the format of every style index.
+        ///  @param formats Formats indexed by style
+        ///
+        void setFormats(const QVector<QTextCharFormat> &formats);
+
+        ///
+        ///  @fn    setSearch
+        ///  @brief Highlights the visible matches of a search.
+        ///  @param search Search over the lines of the source, NULL to
+        ///         stop highlighting
+        ///  @note  Also forgets the current match.
+        ///
+        void setSearch(const QTerminalSearch *search);
+
+        ///
+        ///  @fn    showMatch
+        ///  @brief Marks the current match and scrolls it into view.
+        ///  @param match Match with an absolute line number
+        ///
+        void showMatch(const QTerminalSearch::Match &match);
+
+        ///
+        ///  @fn    setStats
+        ///  @brief Reports the duration of every painted frame.
+        ///  @param stats Counters to report to, NULL to stop
+        ///
+        void setStats(QTerminalStats *stats);
+
+        ///
+        ///  @fn    updateContents
+        ///  @brief Adapts the view to lines appended to or evicted from
+        ///         the source. Sticks to the bottom if it was there.
+        ///
+        void updateContents();
+
+        ///
+        ///  @fn    scrollToBottom
+        ///  @brief Scrolls to the last line and to the start of the rows.
+        ///
+        void scrollToBottom();
+
+
+    signals:
+
+        ///
+        ///  @fn    returnPressed
+        ///  @brief Emitted when return was pressed while reading.
+        ///
+        void returnPressed();
+
+        ///
+        ///  @fn    inputEdited
+        ///  @brief Emitted when the input line of the buffer was edited,
+        ///         so that other views of the buffer can repaint.
+        ///
+        void inputEdited();
+
+
+    protected:
+
+        void paintEvent(QPaintEvent *e);
+        void resizeEvent(QResizeEvent *e);
+        void keyPressEvent(QKeyEvent *e);
+        void scrollContentsBy(int dx, int dy);
+
+
+    private:
+
+        void updateMetrics();
+        void updateScrollBars();
+        QColor foreground(quint16 style) const;
+        QColor background(quint16 style) const;
+        void paintText(QPainter &p, int x, int y, const QString &text, quint16 style);
+
+        //
+        // Private class members
+        //
+        const QTerminalLineSource *m_Source;
+        QTerminalBuffer *m_Buffer;
+        const QTerminalSearch *m_Search;
+        QTerminalStats *m_Stats;
+        QTerminalSearch::Match m_Match;
+        QTerminalDesign m_Design;
+        QVector<QTextCharFormat> m_Formats;
+        qint64 m_EvictedLines;
+        qint32 m_CellWidth;
+        qint32 m_CellHeight;
+        qint32 m_Ascent;
+        bool m_FollowOutput;
+        bool m_HasMatch;
+    };
+}
+
+
+#endif  // __KGL_QTERMINALVIEW_HPP__
@@ -0,0 +1,309 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+//
+//  Included headers
+//
+#include <KGL/Core/QAnsiParser.hpp>
+#include <cstring>
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define KGL_ANSI_SSE2
+#include <emmintrin.h>
+#endif
+
+
+namespace kgl {
+
+    ///
+    ///  @fn        Default constructor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QAnsiParser::QAnsiParser() {
+        reset();
+    }
+
+
+    ///
+    ///  @fn        attributes
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    const QAnsiParser::Attributes &QAnsiParser::attributes() const {
+        return m_Attributes;
+    }
+
+    ///
+    ///  @fn        reset
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QAnsiParser::reset() {
+        m_Attributes.state = TextState::Normal;
+        m_Attributes.foreground = 0;
+        m_Attributes.background = 0;
+        m_Attributes.bold = false;
+        m_Attributes.underline = false;
+        m_Attributes.inverse = false;
+        m_State = State::Ground;
+        m_ParamCount = 0;
+        m_IsPrivate = false;
+    }
+
+    ///
+    ///  @fn        findEscape
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    const QChar *QAnsiParser::findEscape(const QChar *begin, const QChar *end) {
+        const QChar *p = begin;
+
+#ifdef KGL_ANSI_SSE2
+        // Compares eight characters at once
+        const __m128i escape = _mm_set1_epi16(0x1B);
+        while (end - p >= 8) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(chunk, escape)) != 0) {
+                break;
+            }
+
+            p += 8;
+        }
+#else
+        // Compares four characters at once within a 64-bit word
+        while (end - p >= 4) {
+            quint64 word;
+            std::memcpy(&word, p, sizeof(word));
+            quint64 x = word ^ Q_UINT64_C(0x001B001B001B001B);
+            if (((x - Q_UINT64_C(0x0001000100010001)) & ~x & Q_UINT64_C(0x8000800080008000)) != 0) {
+                break;
+            }
+
+            p += 4;
+        }
+#endif
+
+        // Locates the exact position within the last chunk
+        while (p != end && p->unicode() != 0x1B) {
+            ++p;
+        }
+
+        return p;
+    }
+
+    ///
+    ///  @fn        parse
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QAnsiParser::parse(const QChar *data, qint32 length, Handler &handler) {
+        const QChar *end = data + length;
+        const QChar *p = data;
+
+        while (p != end) {
+            // Hands out everything up to the next escape character
+            if (m_State == State::Ground) {
+                const QChar *escape = findEscape(p, end);
+                if (escape != p) {
+                    handler.text(p, static_cast<qint32>(escape - p));
+                }
+                if (escape == end) {
+                    return;
+                }
+
+                m_State = State::Escape;
+                p = escape + 1;
+                continue;
+            }
+
+            ushort c = (p++)->unicode();
+            switch (m_State) {
+            case State::Escape:
+                if (c == '[') {
+                    m_State = State::Csi;
+                    m_Params[0] = 0;
+                    m_ParamCount = 1;
+                    m_IsPrivate = false;
+                } else if (c == ']') {
+                    m_State = State::Osc;
+                } else if (c < 0x20 || c > 0x2F) {
+                    // Two-character sequence; intermediates keep waiting
+                    m_State = (c == 0x1B) ? State::Escape : State::Ground;
+                }
+                break;
+
+            case State::Csi:
+                if (c >= '0' && c <= '9') {
+                    qint32 &param = m_Params[m_ParamCount - 1];
+                    param = qMin(param * 10 + (c - '0'), 0xFFFF);
+                } else if (c == ';' || c == ':') {
+                    if (m_ParamCount < 16) {
+                        m_Params[m_ParamCount++] = 0;
+                    }
+                } else if (c >= '<' && c <= '?') {
+                    m_IsPrivate = true;
+                } else if (c == 0x1B) {
+                    m_State = State::Escape;
+                } else if (c >= 0x40 && c <= 0x7E) {
+                    if (c == 'm' && !m_IsPrivate) {
+                        selectGraphicRendition(handler);
+                    }
+                    m_State = State::Ground;
+                }
+                break;
+
+            case State::Osc:
+                if (c == 0x07) {
+                    m_State = State::Ground;
+                } else if (c == 0x1B) {
+                    m_State = State::OscEscape;
+                }
+                break;
+
+            case State::OscEscape:
+                m_State = (c == '\\') ? State::Ground : State::Osc;
+                break;
+
+            case State::Ground:
+                break;
+            }
+        }
+    }
+
+
+    ///
+    ///  @fn        selectGraphicRendition
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QAnsiParser::selectGraphicRendition(Handler &handler) {
+        for (qint32 i = 0; i < m_ParamCount; ++i) {
+            qint32 p = m_Params[i];
+            qint32 color = -1;
+            quint32 rgb = 0;
+            bool isBackground = false;
+
+            if (p == 0) {
+                m_Attributes.state = TextState::Normal;
+                m_Attributes.foreground = 0;
+                m_Attributes.background = 0;
+                m_Attributes.bold = false;
+                m_Attributes.underline = false;
+                m_Attributes.inverse = false;
+            } else if (p == 1) {
+                m_Attributes.bold = true;
+            } else if (p == 22) {
+                m_Attributes.bold = false;
+            } else if (p == 4) {
+                m_Attributes.underline = true;
+            } else if (p == 24) {
+                m_Attributes.underline = false;
+            } else if (p == 7) {
+                m_Attributes.inverse = true;
+            } else if (p == 27) {
+                m_Attributes.inverse = false;
+            } else if (p >= 30 && p <= 37) {
+                color = p - 30;
+            } else if (p >= 90 && p <= 97) {
+                color = p - 90 + 8;
+            } else if (p == 39) {
+                m_Attributes.state = TextState::Normal;
+                m_Attributes.foreground = 0;
+            } else if (p >= 40 && p <= 47) {
+                m_Attributes.background = paletteColor(p - 40);
+            } else if (p >= 100 && p <= 107) {
+                m_Attributes.background = paletteColor(p - 100 + 8);
+            } else if (p == 49) {
+                m_Attributes.background = 0;
+            } else if ((p == 38 || p == 48) && i + 1 < m_ParamCount) {
+                // Extended colors: 5;index or 2;r;g;b
+                isBackground = (p == 48);
+                if (m_Params[i + 1] == 5 && i + 2 < m_ParamCount) {
+                    color = qMin(m_Params[i + 2], 255);
+                    i += 2;
+                } else if (m_Params[i + 1] == 2 && i + 4 < m_ParamCount) {
+                    rgb = 0xFF000000u
+                        | (static_cast<quint32>(qMin(m_Params[i + 2], 255)) << 16)
+                        | (static_cast<quint32>(qMin(m_Params[i + 3], 255)) << 8)
+                        | static_cast<quint32>(qMin(m_Params[i + 4], 255));
+                    i += 4;
+                } else {
+                    i = m_ParamCount;
+                }
+
+                if (isBackground) {
+                    m_Attributes.background = (color >= 0) ? paletteColor(color) : rgb;
+                    continue;
+                }
+            }
+
+            // Red, green, yellow and white follow the terminal design
+            if (color >= 0 || rgb != 0) {
+                m_Attributes.state = TextState::Normal;
+                m_Attributes.foreground = rgb;
+                switch (color) {
+                case 1: case 9:   m_Attributes.state = TextState::Error;   break;
+                case 2: case 10:  m_Attributes.state = TextState::Success; break;
+                case 3: case 11:  m_Attributes.state = TextState::Warning; break;
+                case 7: case 15:  break;
+                case -1:          break;
+                default:          m_Attributes.foreground = paletteColor(color); break;
+                }
+            }
+        }
+
+        handler.attributes(m_Attributes);
+    }
+
+    ///
+    ///  @fn        paletteColor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    quint32 QAnsiParser::paletteColor(qint32 index) {
+        static const quint32 basic[16] = {
+            0xFF000000, 0xFFCD0000, 0xFF00CD00, 0xFFCDCD00,
+            0xFF0000EE, 0xFFCD00CD, 0xFF00CDCD, 0xFFE5E5E5,
+            0xFF7F7F7F, 0xFFFF0000, 0xFF00FF00, 0xFFFFFF00,
+            0xFF5C5CFF, 0xFFFF00FF, 0xFF00FFFF, 0xFFFFFFFF
+        };
+
+        if (index < 16) {
+            return basic[index];
+        }
+
+        // 6x6x6 color cube
+        if (index < 232) {
+            static const quint32 levels[6] = { 0, 95, 135, 175, 215, 255 };
+            index -= 16;
+            return 0xFF000000u
+                | (levels[index / 36] << 16)
+                | (levels[(index / 6) % 6] << 8)
+                | levels[index % 6];
+        }
+
+        // Grayscale ramp
+        quint32 gray = static_cast<quint32>(8 + (index - 232) * 10);
+        return 0xFF000000u | (gray << 16) | (gray << 8) | gray;
+    }
+}
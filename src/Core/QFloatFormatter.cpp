@@ -0,0 +1,456 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+
+//
+//  Included headers
+//
+#include <KGL/Core/QFloatFormatter.hpp>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+
+namespace kgl {
+
+    //
+    //  Grisu2, after Florian Loitsch, "Printing Floating-Point Numbers
+    //  Quickly and Accurately with Integers" (PLDI 2010)
+    //
+    namespace {
+
+        // Floating-point number f * 2^e with a 64-bit significand
+        struct DiyFp {
+            quint64 f;
+            int e;
+
+            DiyFp(quint64 f, int e) : f(f), e(e) {}
+
+            static DiyFp sub(const DiyFp &x, const DiyFp &y) {
+                return DiyFp(x.f - y.f, x.e);
+            }
+
+            static DiyFp mul(const DiyFp &x, const DiyFp &y) {
+                const quint64 xl = x.f & 0xffffffffu, xh = x.f >> 32;
+                const quint64 yl = y.f & 0xffffffffu, yh = y.f >> 32;
+                const quint64 p0 = xl * yl, p1 = xl * yh;
+                const quint64 p2 = xh * yl, p3 = xh * yh;
+
+                // Rounds the lower 64 bits of the 128-bit product
+                quint64 q = (p0 >> 32) + (p1 & 0xffffffffu) + (p2 & 0xffffffffu);
+                q += Q_UINT64_C(1) << 31;
+                return DiyFp(p3 + (p1 >> 32) + (p2 >> 32) + (q >> 32), x.e + y.e + 64);
+            }
+
+            static DiyFp normalize(DiyFp x) {
+                while ((x.f >> 63) == 0) {
+                    x.f <<= 1;
+                    x.e--;
+                }
+                return x;
+            }
+
+            static DiyFp normalizeTo(const DiyFp &x, int e) {
+                return DiyFp(x.f << (x.e - e), e);
+            }
+        };
+
+        // Value and the boundaries of its rounding interval
+        struct Boundaries {
+            DiyFp w, minus, plus;
+        };
+
+        quint64 toBits(double value) {
+            quint64 bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        quint64 toBits(float value) {
+            quint32 bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        template <typename T>
+        Boundaries computeBoundaries(T value) {
+            const int precision = std::numeric_limits<T>::digits;
+            const int bias = std::numeric_limits<T>::max_exponent - 1 + (precision - 1);
+            const int minimumExponent = 1 - bias;
+            const quint64 hiddenBit = Q_UINT64_C(1) << (precision - 1);
+
+            const quint64 bits = toBits(value);
+            const quint64 exponent = bits >> (precision - 1);
+            const quint64 fraction = bits & (hiddenBit - 1);
+            const DiyFp v = (exponent == 0)
+                    ? DiyFp(fraction, minimumExponent)
+                    : DiyFp(fraction + hiddenBit, int(exponent) - bias);
+
+            // The lower neighbour is closer at a power of two
+            const bool closer = fraction == 0 && exponent > 1;
+            const DiyFp plus(2 * v.f + 1, v.e - 1);
+            const DiyFp minus = closer
+                    ? DiyFp(4 * v.f - 1, v.e - 2)
+                    : DiyFp(2 * v.f - 1, v.e - 1);
+
+            const DiyFp normalizedPlus = DiyFp::normalize(plus);
+            Boundaries b = {
+                DiyFp::normalize(v),
+                DiyFp::normalizeTo(minus, normalizedPlus.e),
+                normalizedPlus
+            };
+            return b;
+        }
+
+        // Normalized powers of ten, 10^-300 to 10^324 in steps of eight
+        struct CachedPower {
+            quint64 f;
+            int e;
+            int k;
+        };
+
+        const int Alpha = -60;
+        const int Gamma = -32;
+        const int CachedPowersMinimum = -300;
+        const int CachedPowersStep = 8;
+        const CachedPower CachedPowers[] = {
+            { Q_UINT64_C(0xAB70FE17C79AC6CA), -1060, -300 },
+            { Q_UINT64_C(0xFF77B1FCBEBCDC4F), -1034, -292 },
+            { Q_UINT64_C(0xBE5691EF416BD60C), -1007, -284 },
+            { Q_UINT64_C(0x8DD01FAD907FFC3C),  -980, -276 },
+            { Q_UINT64_C(0xD3515C2831559A83),  -954, -268 },
+            { Q_UINT64_C(0x9D71AC8FADA6C9B5),  -927, -260 },
+            { Q_UINT64_C(0xEA9C227723EE8BCB),  -901, -252 },
+            { Q_UINT64_C(0xAECC49914078536D),  -874, -244 },
+            { Q_UINT64_C(0x823C12795DB6CE57),  -847, -236 },
+            { Q_UINT64_C(0xC21094364DFB5637),  -821, -228 },
+            { Q_UINT64_C(0x9096EA6F3848984F),  -794, -220 },
+            { Q_UINT64_C(0xD77485CB25823AC7),  -768, -212 },
+            { Q_UINT64_C(0xA086CFCD97BF97F4),  -741, -204 },
+            { Q_UINT64_C(0xEF340A98172AACE5),  -715, -196 },
+            { Q_UINT64_C(0xB23867FB2A35B28E),  -688, -188 },
+            { Q_UINT64_C(0x84C8D4DFD2C63F3B),  -661, -180 },
+            { Q_UINT64_C(0xC5DD44271AD3CDBA),  -635, -172 },
+            { Q_UINT64_C(0x936B9FCEBB25C996),  -608, -164 },
+            { Q_UINT64_C(0xDBAC6C247D62A584),  -582, -156 },
+            { Q_UINT64_C(0xA3AB66580D5FDAF6),  -555, -148 },
+            { Q_UINT64_C(0xF3E2F893DEC3F126),  -529, -140 },
+            { Q_UINT64_C(0xB5B5ADA8AAFF80B8),  -502, -132 },
+            { Q_UINT64_C(0x87625F056C7C4A8B),  -475, -124 },
+            { Q_UINT64_C(0xC9BCFF6034C13053),  -449, -116 },
+            { Q_UINT64_C(0x964E858C91BA2655),  -422, -108 },
+            { Q_UINT64_C(0xDFF9772470297EBD),  -396, -100 },
+            { Q_UINT64_C(0xA6DFBD9FB8E5B88F),  -369,  -92 },
+            { Q_UINT64_C(0xF8A95FCF88747D94),  -343,  -84 },
+            { Q_UINT64_C(0xB94470938FA89BCF),  -316,  -76 },
+            { Q_UINT64_C(0x8A08F0F8BF0F156B),  -289,  -68 },
+            { Q_UINT64_C(0xCDB02555653131B6),  -263,  -60 },
+            { Q_UINT64_C(0x993FE2C6D07B7FAC),  -236,  -52 },
+            { Q_UINT64_C(0xE45C10C42A2B3B06),  -210,  -44 },
+            { Q_UINT64_C(0xAA242499697392D3),  -183,  -36 },
+            { Q_UINT64_C(0xFD87B5F28300CA0E),  -157,  -28 },
+            { Q_UINT64_C(0xBCE5086492111AEB),  -130,  -20 },
+            { Q_UINT64_C(0x8CBCCC096F5088CC),  -103,  -12 },
+            { Q_UINT64_C(0xD1B71758E219652C),   -77,   -4 },
+            { Q_UINT64_C(0x9C40000000000000),   -50,    4 },
+            { Q_UINT64_C(0xE8D4A51000000000),   -24,   12 },
+            { Q_UINT64_C(0xAD78EBC5AC620000),     3,   20 },
+            { Q_UINT64_C(0x813F3978F8940984),    30,   28 },
+            { Q_UINT64_C(0xC097CE7BC90715B3),    56,   36 },
+            { Q_UINT64_C(0x8F7E32CE7BEA5C70),    83,   44 },
+            { Q_UINT64_C(0xD5D238A4ABE98068),   109,   52 },
+            { Q_UINT64_C(0x9F4F2726179A2245),   136,   60 },
+            { Q_UINT64_C(0xED63A231D4C4FB27),   162,   68 },
+            { Q_UINT64_C(0xB0DE65388CC8ADA8),   189,   76 },
+            { Q_UINT64_C(0x83C7088E1AAB65DB),   216,   84 },
+            { Q_UINT64_C(0xC45D1DF942711D9A),   242,   92 },
+            { Q_UINT64_C(0x924D692CA61BE758),   269,  100 },
+            { Q_UINT64_C(0xDA01EE641A708DEA),   295,  108 },
+            { Q_UINT64_C(0xA26DA3999AEF774A),   322,  116 },
+            { Q_UINT64_C(0xF209787BB47D6B85),   348,  124 },
+            { Q_UINT64_C(0xB454E4A179DD1877),   375,  132 },
+            { Q_UINT64_C(0x865B86925B9BC5C2),   402,  140 },
+            { Q_UINT64_C(0xC83553C5C8965D3D),   428,  148 },
+            { Q_UINT64_C(0x952AB45CFA97A0B3),   455,  156 },
+            { Q_UINT64_C(0xDE469FBD99A05FE3),   481,  164 },
+            { Q_UINT64_C(0xA59BC234DB398C25),   508,  172 },
+            { Q_UINT64_C(0xF6C69A72A3989F5C),   534,  180 },
+            { Q_UINT64_C(0xB7DCBF5354E9BECE),   561,  188 },
+            { Q_UINT64_C(0x88FCF317F22241E2),   588,  196 },
+            { Q_UINT64_C(0xCC20CE9BD35C78A5),   614,  204 },
+            { Q_UINT64_C(0x98165AF37B2153DF),   641,  212 },
+            { Q_UINT64_C(0xE2A0B5DC971F303A),   667,  220 },
+            { Q_UINT64_C(0xA8D9D1535CE3B396),   694,  228 },
+            { Q_UINT64_C(0xFB9B7CD9A4A7443C),   720,  236 },
+            { Q_UINT64_C(0xBB764C4CA7A44410),   747,  244 },
+            { Q_UINT64_C(0x8BAB8EEFB6409C1A),   774,  252 },
+            { Q_UINT64_C(0xD01FEF10A657842C),   800,  260 },
+            { Q_UINT64_C(0x9B10A4E5E9913129),   827,  268 },
+            { Q_UINT64_C(0xE7109BFBA19C0C9D),   853,  276 },
+            { Q_UINT64_C(0xAC2820D9623BF429),   880,  284 },
+            { Q_UINT64_C(0x80444B5E7AA7CF85),   907,  292 },
+            { Q_UINT64_C(0xBF21E44003ACDD2D),   933,  300 },
+            { Q_UINT64_C(0x8E679C2F5E44FF8F),   960,  308 },
+            { Q_UINT64_C(0xD433179D9C8CB841),   986,  316 },
+            { Q_UINT64_C(0x9E19DB92B4E31BA9),  1013,  324 },
+        };
+
+        // Picks c = 10^-k such that the product's exponent is in [Alpha, Gamma]
+        const CachedPower &cachedPower(int e) {
+            const int f = Alpha - e - 1;
+            const int k = (f * 78913) / (1 << 18) + (f > 0 ? 1 : 0);
+            const int index = (-CachedPowersMinimum + k + (CachedPowersStep - 1)) / CachedPowersStep;
+            return CachedPowers[index];
+        }
+
+        int largestPow10(quint32 n, quint32 &pow10) {
+            static const quint32 powers[] = {
+                1u, 10u, 100u, 1000u, 10000u, 100000u,
+                1000000u, 10000000u, 100000000u, 1000000000u
+            };
+
+            int digits = 10;
+            while (digits > 1 && n < powers[digits - 1])
+                --digits;
+
+            pow10 = powers[digits - 1];
+            return digits;
+        }
+
+        // Moves the last digit closer to the exact value while it stays in range
+        void round(char *digits, int length, quint64 distance, quint64 delta, quint64 rest, quint64 tenK) {
+            while (rest < distance && delta - rest >= tenK &&
+                   (rest + tenK < distance || distance - rest > rest + tenK - distance)) {
+                digits[length - 1]--;
+                rest += tenK;
+            }
+        }
+
+        void generateDigits(char *digits, int &length, int &exponent,
+                            const DiyFp &minus, const DiyFp &w, const DiyFp &plus) {
+            quint64 delta = DiyFp::sub(plus, minus).f;
+            quint64 distance = DiyFp::sub(plus, w).f;
+
+            const DiyFp one(Q_UINT64_C(1) << -plus.e, plus.e);
+            quint32 p1 = quint32(plus.f >> -one.e);
+            quint64 p2 = plus.f & (one.f - 1);
+
+            // Integral part
+            quint32 pow10;
+            int n = largestPow10(p1, pow10);
+            while (n > 0) {
+                digits[length++] = char('0' + p1 / pow10);
+                p1 %= pow10;
+                n--;
+
+                const quint64 rest = (quint64(p1) << -one.e) + p2;
+                if (rest <= delta) {
+                    exponent += n;
+                    round(digits, length, distance, delta, rest, quint64(pow10) << -one.e);
+                    return;
+                }
+                pow10 /= 10;
+            }
+
+            // Fractional part
+            int m = 0;
+            for (;;) {
+                p2 *= 10;
+                digits[length++] = char('0' + (p2 >> -one.e));
+                p2 &= one.f - 1;
+                m++;
+
+                delta *= 10;
+                distance *= 10;
+                if (p2 <= delta)
+                    break;
+            }
+
+            exponent -= m;
+            round(digits, length, distance, delta, p2, one.f);
+        }
+
+        template <typename T>
+        void grisu2(char *digits, int &length, int &exponent, T value) {
+            const Boundaries b = computeBoundaries(value);
+            const CachedPower &cached = cachedPower(b.plus.e);
+            const DiyFp c(cached.f, cached.e);
+
+            const DiyFp w = DiyFp::mul(b.w, c);
+            const DiyFp minus = DiyFp::mul(b.minus, c);
+            const DiyFp plus = DiyFp::mul(b.plus, c);
+
+            // Shrinks the interval by one unit on both sides to stay safe
+            length = 0;
+            exponent = -cached.k;
+            generateDigits(digits, length, exponent,
+                           DiyFp(minus.f + 1, minus.e), w,
+                           DiyFp(plus.f - 1, plus.e));
+        }
+
+        // Places the decimal point or appends an exponent
+        char *compose(char *dst, const char *digits, int length, int exponent) {
+            const int point = length + exponent;
+
+            if (length <= point && point <= 21) {
+                std::memcpy(dst, digits, length);
+                std::memset(dst + length, '0', point - length);
+                return dst + point;
+            }
+            if (0 < point && point <= 21) {
+                std::memcpy(dst, digits, point);
+                dst[point] = '.';
+                std::memcpy(dst + point + 1, digits + point, length - point);
+                return dst + length + 1;
+            }
+            if (-6 < point && point <= 0) {
+                *dst++ = '0';
+                *dst++ = '.';
+                std::memset(dst, '0', -point);
+                std::memcpy(dst - point, digits, length);
+                return dst - point + length;
+            }
+
+            *dst++ = digits[0];
+            if (length > 1) {
+                *dst++ = '.';
+                std::memcpy(dst, digits + 1, length - 1);
+                dst += length - 1;
+            }
+
+            int e = point - 1;
+            *dst++ = 'e';
+            *dst++ = e < 0 ? '-' : '+';
+            e = e < 0 ? -e : e;
+            if (e >= 100)
+                *dst++ = char('0' + e / 100);
+            if (e >= 10)
+                *dst++ = char('0' + e / 10 % 10);
+            *dst++ = char('0' + e % 10);
+            return dst;
+        }
+
+        template <typename T>
+        qint32 formatShortest(T value, QChar *out) {
+            char buffer[64];
+            char *dst = buffer;
+
+            if (std::isnan(value)) {
+                std::memcpy(dst, "nan", 3);
+                dst += 3;
+            } else {
+                if (std::signbit(value)) {
+                    *dst++ = '-';
+                    value = -value;
+                }
+                if (std::isinf(value)) {
+                    std::memcpy(dst, "inf", 3);
+                    dst += 3;
+                } else if (value == 0) {
+                    *dst++ = '0';
+                } else {
+                    char digits[32];
+                    int length, exponent;
+                    grisu2(digits, length, exponent, value);
+                    dst = compose(dst, digits, length, exponent);
+                }
+            }
+
+            const qint32 length = qint32(dst - buffer);
+            for (qint32 i = 0; i < length; ++i)
+                out[i] = QLatin1Char(buffer[i]);
+
+            return length;
+        }
+
+        qint32 formatPrecision(double value, FloatFormat f, qint32 precision, QChar *out) {
+            char buffer[QFloatFormatter::MaximumLength];
+            precision = qBound(0, precision, int(QFloatFormatter::MaximumPrecision));
+
+            const int length = std::snprintf(buffer, sizeof(buffer),
+                    f == FloatFormat::Fixed ? "%.*f" : "%.*e", precision, value);
+
+            // printf honours the C locale; always emits a '.' instead
+            qint32 count = 0;
+            for (int i = 0; i < length; ++i) {
+                const uchar c = uchar(buffer[i]);
+                if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') ||
+                    (c >= 'A' && c <= 'Z') || c == '-' || c == '+') {
+                    out[count++] = QLatin1Char(char(c));
+                } else {
+                    out[count++] = QLatin1Char('.');
+                    while (i + 1 < length && uchar(buffer[i + 1]) >= 0x80)
+                        ++i;
+                }
+            }
+
+            return count;
+        }
+    }
+
+
+    ///
+    ///  @fn        format
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint32 QFloatFormatter::format(double value, FloatFormat f, qint32 precision, QChar *out) {
+        if (f == FloatFormat::Shortest)
+            return formatShortest(value, out);
+        else
+            return formatPrecision(value, f, precision, out);
+    }
+
+    ///
+    ///  @fn        format
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint32 QFloatFormatter::format(float value, FloatFormat f, qint32 precision, QChar *out) {
+        if (f == FloatFormat::Shortest)
+            return formatShortest(value, out);
+        else
+            return formatPrecision(double(value), f, precision, out);
+    }
+
+    ///
+    ///  @fn        append
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QFloatFormatter::append(double value, FloatFormat f, qint32 precision, QString &out) {
+        QChar buffer[MaximumLength];
+        out.append(buffer, format(value, f, precision, buffer));
+    }
+
+    ///
+    ///  @fn        append
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QFloatFormatter::append(float value, FloatFormat f, qint32 precision, QString &out) {
+        QChar buffer[MaximumLength];
+        out.append(buffer, format(value, f, precision, buffer));
+    }
+}
@@ -0,0 +1,232 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+
+//
+//  Included headers
+//
+#include <KGL/Core/QNumberFormatter.hpp>
+#include <cstring>
+
+
+namespace kgl {
+
+    //
+    //  Lookup tables
+    //
+    namespace {
+        struct DigitTables {
+            char decimal[200];      // "00" to "99"
+            char hexadecimal[512];  // "00" to "ff"
+            char octal[128];        // "00" to "77"
+            char binary[64];        // "0000" to "1111"
+
+            DigitTables() {
+                const char *nibbles = "0123456789abcdef";
+                for (int i = 0; i < 100; ++i) {
+                    decimal[i * 2 + 0] = char('0' + i / 10);
+                    decimal[i * 2 + 1] = char('0' + i % 10);
+                }
+                for (int i = 0; i < 256; ++i) {
+                    hexadecimal[i * 2 + 0] = nibbles[i >> 4];
+                    hexadecimal[i * 2 + 1] = nibbles[i & 15];
+                }
+                for (int i = 0; i < 64; ++i) {
+                    octal[i * 2 + 0] = char('0' + (i >> 3));
+                    octal[i * 2 + 1] = char('0' + (i & 7));
+                }
+                for (int i = 0; i < 16; ++i) {
+                    for (int j = 0; j < 4; ++j)
+                        binary[i * 4 + j] = char('0' + ((i >> (3 - j)) & 1));
+                }
+            }
+        };
+
+        const DigitTables &tables() {
+            static const DigitTables t;
+            return t;
+        }
+
+        const qint32 MaximumWidth = 128;
+    }
+
+
+    ///
+    ///  @fn        Options::Options
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QNumberFormatter::Options::Options()
+        : format(NumberFormat::Decimal)
+        , width(0)
+        , fill(QLatin1Char('0'))
+        , separator() {
+    }
+
+
+    ///
+    ///  @fn        format
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint32 QNumberFormatter::format(quint64 value, const Options &options, QChar *out) {
+        return formatDigits(value, options, false, out);
+    }
+
+    ///
+    ///  @fn        format
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint32 QNumberFormatter::format(qint64 value, const Options &options, QChar *out) {
+        if (value < 0)
+            return formatDigits(Q_UINT64_C(0) - quint64(value), options, true, out);
+        else
+            return formatDigits(quint64(value), options, false, out);
+    }
+
+    ///
+    ///  @fn        append
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QNumberFormatter::append(quint64 value, const Options &options, QString &out) {
+        QChar buffer[MaximumLength];
+        out.append(buffer, formatDigits(value, options, false, buffer));
+    }
+
+    ///
+    ///  @fn        append
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QNumberFormatter::append(qint64 value, const Options &options, QString &out) {
+        QChar buffer[MaximumLength];
+        out.append(buffer, format(value, options, buffer));
+    }
+
+
+    ///
+    ///  @fn        formatDigits
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint32 QNumberFormatter::formatDigits(quint64 value, const Options &options, bool negative, QChar *out) {
+        const DigitTables &t = tables();
+        char digits[MaximumWidth + 8];
+        char *end = digits + sizeof(digits);
+        char *p = end;
+        qint32 group = 4;
+
+        // Produces the digits back to front, several at a time
+        switch (options.format) {
+        case NumberFormat::Decimal:
+            group = 3;
+            while (value >= 100) {
+                p -= 2;
+                std::memcpy(p, t.decimal + (value % 100) * 2, 2);
+                value /= 100;
+            }
+            if (value >= 10) {
+                p -= 2;
+                std::memcpy(p, t.decimal + value * 2, 2);
+            } else {
+                *--p = char('0' + value);
+            }
+            break;
+
+        case NumberFormat::Hexadecimal:
+            do {
+                p -= 2;
+                std::memcpy(p, t.hexadecimal + (value & 0xff) * 2, 2);
+                value >>= 8;
+            } while (value != 0);
+            break;
+
+        case NumberFormat::Octal:
+            do {
+                p -= 2;
+                std::memcpy(p, t.octal + (value & 0x3f) * 2, 2);
+                value >>= 6;
+            } while (value != 0);
+            break;
+
+        case NumberFormat::Binary:
+            do {
+                p -= 4;
+                std::memcpy(p, t.binary + (value & 0xf) * 4, 4);
+                value >>= 4;
+            } while (value != 0);
+            break;
+        }
+
+        // Strips the leading zeroes of the last chunk
+        while (p < end - 1 && *p == '0')
+            ++p;
+
+        qint32 width = qMin(options.width, MaximumWidth);
+        qint32 count = qint32(end - p);
+        qint32 sign = negative ? 1 : 0;
+        bool grouped = !options.separator.isNull();
+        bool zeroes = options.fill == QLatin1Char('0');
+
+        // Zero-padding counts towards the digits and their groups
+        if (zeroes) {
+            while (sign + count + (grouped ? (count - 1) / group : 0) < width) {
+                *--p = '0';
+                ++count;
+            }
+        }
+
+        qint32 length = sign + count + (grouped ? (count - 1) / group : 0);
+        QChar *dst = out;
+
+        if (!zeroes) {
+            for (; length < width; ++length)
+                *dst++ = options.fill;
+        }
+        if (negative)
+            *dst++ = QLatin1Char('-');
+
+        if (!grouped) {
+            while (p < end)
+                *dst++ = QLatin1Char(*p++);
+        } else {
+            qint32 chunk = count % group;
+            if (chunk == 0)
+                chunk = group;
+
+            for (;;) {
+                for (qint32 i = 0; i < chunk; ++i)
+                    *dst++ = QLatin1Char(*p++);
+                if (p == end)
+                    break;
+
+                *dst++ = options.separator;
+                chunk = group;
+            }
+        }
+
+        return length;
+    }
+}
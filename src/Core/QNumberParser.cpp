@@ -0,0 +1,141 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+
+//
+//  Included headers
+//
+#include <KGL/Core/QNumberParser.hpp>
+
+
+namespace kgl {
+
+    //
+    //  Digit values, 0xff for characters that are no digits
+    //
+    namespace {
+        inline quint32 digitValue(ushort c) {
+            if (c >= '0' && c <= '9')
+                return c - '0';
+
+            c |= 0x20;
+            if (c >= 'a' && c <= 'f')
+                return c - 'a' + 10;
+
+            return 0xff;
+        }
+
+        inline bool isBlank(ushort c) {
+            return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+        }
+    }
+
+
+    ///
+    ///  @fn        parseMagnitude
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QNumberParser::Status QNumberParser::parseMagnitude(const QChar *data, qint32 length, NumberFormat f,
+                                                        quint64 &magnitude, bool &negative) {
+        const ushort *src = reinterpret_cast<const ushort *>(data);
+        const ushort *end = src + length;
+        magnitude = 0;
+        negative = false;
+
+        // Skips surrounding blanks
+        while (src < end && isBlank(*src))
+            ++src;
+        while (end > src && isBlank(end[-1]))
+            --end;
+
+        if (src < end && (*src == '-' || *src == '+'))
+            negative = *src++ == '-';
+
+        // Determines the base; a prefix overrides the default one
+        quint32 shift = 0;
+        quint32 base;
+        switch (f) {
+        case NumberFormat::Hexadecimal: base = 16; break;
+        case NumberFormat::Octal:       base = 8;  break;
+        case NumberFormat::Binary:      base = 2;  break;
+        default:                        base = 10; break;
+        }
+
+        if (src < end && *src == '$') {
+            base = 16;
+            src += 1;
+        } else if (end - src > 2 && src[0] == '&' && (src[1] | 0x20) == 'h') {
+            base = 16;
+            src += 2;
+        } else if (end - src > 2 && src[0] == '0') {
+            const ushort p = src[1] | 0x20;
+            if (p == 'x') {
+                base = 16;
+                src += 2;
+            } else if (base != 16 && p == 'o') {
+                base = 8;
+                src += 2;
+            } else if (base != 16 && p == 'b') {
+                base = 2;
+                src += 2;
+            }
+        }
+
+        if (base == 16) shift = 4;
+        if (base == 8)  shift = 3;
+        if (base == 2)  shift = 1;
+
+        // Accumulates modulo 2^64 and remembers whether bits were lost
+        bool overflow = false;
+        bool separator = false;
+        qint32 digits = 0;
+        for (; src < end; ++src) {
+            const ushort c = *src;
+            const quint32 d = digitValue(c);
+
+            if (d < base) {
+                if (shift != 0) {
+                    overflow |= (magnitude >> (64 - shift)) != 0;
+                    magnitude = (magnitude << shift) | d;
+                } else {
+                    const quint64 limit = (std::numeric_limits<quint64>::max() - d) / 10;
+                    overflow |= magnitude > limit;
+                    magnitude = magnitude * 10 + d;
+                }
+
+                separator = false;
+                ++digits;
+            } else if ((c == '_' || c == '\'') && digits > 0 && !separator) {
+                separator = true;
+            } else {
+                return Status::Invalid;
+            }
+        }
+
+        if (digits == 0 || separator)
+            return Status::Invalid;
+
+        return overflow ? Status::Overflow : Status::Ok;
+    }
+}
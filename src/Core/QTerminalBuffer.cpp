@@ -0,0 +1,433 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+//
+//  Included headers
+//
+#include <KGL/Core/QTerminalBuffer.hpp>
+
+
+namespace kgl {
+
+    ///
+    ///  @fn        Default constructor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalBuffer::QTerminalBuffer()
+        : m_HeldBytes(0),
+          m_EvictedLines(0),
+          m_MaximumBytes(0),
+          m_MaximumLines(0),
+          m_MaximumLength(0),
+          m_MaximumCount(0),
+          m_InputCaret(0),
+          m_InputStyle(0),
+          m_IsReadingInput(false) {
+        clear();
+    }
+
+    ///
+    ///  @fn        Destructor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalBuffer::~QTerminalBuffer() {
+    }
+
+
+    ///
+    ///  @fn        lineCount
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint64 QTerminalBuffer::lineCount() const {
+        return m_Lines.size();
+    }
+
+    ///
+    ///  @fn        line
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    const QTerminalBuffer::Line &QTerminalBuffer::line(qint64 index) const {
+        return m_Lines.at(static_cast<int>(index));
+    }
+
+    ///
+    ///  @fn        maximumLength
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint32 QTerminalBuffer::maximumLength() const {
+        if (m_MaximumCount >= 0) {
+            return m_MaximumLength;
+        }
+
+        // The longest lines were evicted; counts the new longest ones
+        m_MaximumLength = 0;
+        m_MaximumCount = 0;
+        for (const Line &line : m_Lines) {
+            if (line.text.size() > m_MaximumLength) {
+                m_MaximumLength = line.text.size();
+                m_MaximumCount = 1;
+            } else if (line.text.size() == m_MaximumLength && m_MaximumLength > 0) {
+                m_MaximumCount++;
+            }
+        }
+
+        return m_MaximumLength;
+    }
+
+    ///
+    ///  @fn        heldBytes
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint64 QTerminalBuffer::heldBytes() const {
+        return m_HeldBytes;
+    }
+
+    ///
+    ///  @fn        evictedLines
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint64 QTerminalBuffer::evictedLines() const {
+        return m_EvictedLines;
+    }
+
+    ///
+    ///  @fn        maximumLines
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint32 QTerminalBuffer::maximumLines() const {
+        return m_MaximumLines;
+    }
+
+    ///
+    ///  @fn        maximumBytes
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint64 QTerminalBuffer::maximumBytes() const {
+        return m_MaximumBytes;
+    }
+
+    ///
+    ///  @fn        isReadingInput
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalBuffer::isReadingInput() const {
+        return m_IsReadingInput;
+    }
+
+    ///
+    ///  @fn        input
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    const QString &QTerminalBuffer::input() const {
+        return m_Input;
+    }
+
+    ///
+    ///  @fn        inputCaret
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint32 QTerminalBuffer::inputCaret() const {
+        return m_InputCaret;
+    }
+
+    ///
+    ///  @fn        inputStyle
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    quint16 QTerminalBuffer::inputStyle() const {
+        return m_InputStyle;
+    }
+
+    ///
+    ///  @fn        styleOf
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    quint16 QTerminalBuffer::styleOf(TextState state, bool highlight) {
+        return static_cast<quint16>(static_cast<int>(state) * 2 + (highlight ? 1 : 0));
+    }
+
+
+    ///
+    ///  @fn        setMaximumLines
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalBuffer::setMaximumLines(qint32 lines) {
+        m_MaximumLines = qMax(0, lines);
+        trim();
+    }
+
+    ///
+    ///  @fn        setMaximumBytes
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalBuffer::setMaximumBytes(qint64 bytes) {
+        m_MaximumBytes = qMax(Q_INT64_C(0), bytes);
+        trim();
+    }
+
+    ///
+    ///  @fn        append
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalBuffer::append(const QString &text, quint16 style) {
+        append(text.constData(), text.size(), style);
+    }
+
+    ///
+    ///  @fn        append
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalBuffer::append(const QChar *data, qint32 length, quint16 style) {
+        const QChar *end = data + length;
+        const QChar *start = data;
+
+        // Splits the text at every line feed
+        for (const QChar *c = data; c != end; ++c) {
+            if (c->unicode() == '\n') {
+                appendToLine(start, static_cast<qint32>(c - start), style);
+                m_Lines.append(Line());
+                m_HeldBytes += sizeof(Line);
+                start = c + 1;
+            }
+        }
+
+        appendToLine(start, static_cast<qint32>(end - start), style);
+        trim();
+    }
+
+    ///
+    ///  @fn        append
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalBuffer::append(const QString &text, TextState state, bool highlight) {
+        append(text.constData(), text.size(), styleOf(state, highlight));
+    }
+
+    ///
+    ///  @fn        restyleOpenLine
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalBuffer::restyleOpenLine(qint32 start, qint32 length, quint16 style) {
+        Line &line = m_Lines.last();
+        start = qBound(0, start, line.text.size());
+        qint32 end = start + qBound(0, length, line.text.size() - start);
+        if (start == end) {
+            return;
+        }
+
+        // Cuts the runs at both ends of the range and merges equal neighbours
+        QVector<Run> runs;
+        auto append = [&runs](qint32 position, qint32 count, quint16 s) {
+            if (count <= 0) {
+                return;
+            }
+            if (!runs.isEmpty() && runs.last().style == s) {
+                runs.last().length += count;
+            } else {
+                Run run = { position, count, s };
+                runs.append(run);
+            }
+        };
+
+        for (const Run &run : qAsConst(line.runs)) {
+            qint32 runEnd = run.start + run.length;
+            append(run.start, qMin(runEnd, start) - run.start, run.style);
+            append(qMax(run.start, start), qMin(runEnd, end) - qMax(run.start, start), style);
+            append(qMax(run.start, end), runEnd - qMax(run.start, end), run.style);
+        }
+
+        m_HeldBytes += (runs.size() - line.runs.size()) * static_cast<qint64>(sizeof(Run));
+        line.runs.swap(runs);
+    }
+
+    ///
+    ///  @fn        clear
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalBuffer::clear() {
+        m_Lines.clear();
+        m_Lines.append(Line());
+        m_HeldBytes = sizeof(Line);
+        m_MaximumLength = 0;
+        m_MaximumCount = 0;
+    }
+
+    ///
+    ///  @fn        beginInput
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalBuffer::beginInput(quint16 style) {
+        m_Input.clear();
+        m_InputCaret = 0;
+        m_InputStyle = style;
+        m_IsReadingInput = true;
+    }
+
+    ///
+    ///  @fn        endInput
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalBuffer::endInput() {
+        m_Input.clear();
+        m_InputCaret = 0;
+        m_IsReadingInput = false;
+    }
+
+    ///
+    ///  @fn        commitInput
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QString QTerminalBuffer::commitInput() {
+        QString line = m_Input;
+        endInput();
+
+        // The committed line becomes regular output
+        append(line + QLatin1Char('\n'), m_InputStyle);
+        return line;
+    }
+
+    ///
+    ///  @fn        insertInput
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalBuffer::insertInput(const QString &text) {
+        if (!m_IsReadingInput) {
+            return;
+        }
+
+        m_Input.insert(m_InputCaret, text);
+        m_InputCaret += text.size();
+    }
+
+    ///
+    ///  @fn        removeInput
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalBuffer::removeInput(qint32 count) {
+        if (count < 0) {
+            count = qMin(-count, m_InputCaret);
+            m_InputCaret -= count;
+        } else {
+            count = qMin(count, m_Input.size() - m_InputCaret);
+        }
+
+        m_Input.remove(m_InputCaret, count);
+    }
+
+    ///
+    ///  @fn        setInputCaret
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalBuffer::setInputCaret(qint32 caret) {
+        m_InputCaret = qBound(0, caret, m_Input.size());
+    }
+
+
+    ///
+    ///  @fn        appendToLine
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalBuffer::appendToLine(const QChar *data, qint32 length, quint16 style) {
+        if (length == 0) {
+            return;
+        }
+
+        Line &line = m_Lines.last();
+        qint32 start = line.text.size();
+        line.text.append(data, length);
+        m_HeldBytes += length * static_cast<qint64>(sizeof(QChar));
+
+        // Counts the lines of maximum length, unless a rescan is due;
+        // the stale maximum still bounds the length of all lines
+        if (line.text.size() > m_MaximumLength) {
+            m_MaximumLength = line.text.size();
+            m_MaximumCount = 1;
+        } else if (line.text.size() == m_MaximumLength && m_MaximumCount >= 0) {
+            m_MaximumCount++;
+        }
+
+        // Extends the last run if the style did not change
+        if (!line.runs.isEmpty() && line.runs.last().style == style) {
+            line.runs.last().length += length;
+        } else {
+            Run run = { start, length, style };
+            line.runs.append(run);
+            m_HeldBytes += sizeof(Run);
+        }
+    }
+
+    ///
+    ///  @fn        trim
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalBuffer::trim() {
+        // Drops lines from the top, but always keeps the open line
+        while (m_Lines.size() > 1) {
+            bool exceedsLines = m_MaximumLines > 0 && m_Lines.size() > m_MaximumLines;
+            bool exceedsBytes = m_MaximumBytes > 0 && m_HeldBytes > m_MaximumBytes;
+            if (!exceedsLines && !exceedsBytes) {
+                break;
+            }
+
+            const Line &line = m_Lines.first();
+            m_HeldBytes -= sizeof(Line);
+            m_HeldBytes -= line.text.size() * static_cast<qint64>(sizeof(QChar));
+            m_HeldBytes -= line.runs.size() * static_cast<qint64>(sizeof(Run));
+            if (m_MaximumCount > 0 && line.text.size() == m_MaximumLength && --m_MaximumCount == 0) {
+                m_MaximumCount = -1;
+            }
+
+            m_Lines.removeFirst();
+            m_EvictedLines++;
+        }
+    }
+}
@@ -0,0 +1,439 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+
+//
+//  Included headers
+//
+#include <KGL/Core/QTerminalHighlighter.hpp>
+#include <algorithm>
+#include <cstring>
+
+
+namespace kgl {
+
+    //
+    //  Match found by either matcher, before overlaps are resolved
+    //
+    namespace {
+        struct Candidate {
+            qint32 start;
+            qint32 length;
+            qint32 rank;
+            quint16 style;
+        };
+
+        bool isPreferred(const Candidate &a, const Candidate &b) {
+            if (a.start != b.start)
+                return a.start < b.start;
+            if (a.length != b.length)
+                return a.length > b.length;
+            return a.rank < b.rank;
+        }
+
+        inline quint64 edgeKey(qint32 state, ushort c) {
+            return (static_cast<quint64>(state) << 16) | c;
+        }
+    }
+
+
+    ///
+    ///  @fn        Default constructor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalHighlighter::QTerminalHighlighter()
+        : m_NextId(0) {
+        compile();
+    }
+
+
+    ///
+    ///  @fn        add
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint32 QTerminalHighlighter::add(const QString &pattern, PatternSyntax syntax, Qt::CaseSensitivity cs, quint16 style) {
+        if (pattern.isEmpty())
+            return -1;
+        if (syntax == PatternSyntax::RegularExpression && !QRegularExpression(pattern).isValid())
+            return -1;
+
+        Rule rule;
+        rule.pattern = pattern;
+        rule.syntax = syntax;
+        rule.cs = cs;
+        rule.style = style;
+        rule.id = m_NextId++;
+        rule.group = 0;
+        rule.next = -1;
+        m_Rules.append(rule);
+
+        // Joined expressions may still clash, e.g. on duplicate names
+        if (!compile()) {
+            m_Rules.removeLast();
+            m_NextId--;
+            compile();
+            return -1;
+        }
+
+        return rule.id;
+    }
+
+    ///
+    ///  @fn        remove
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalHighlighter::remove(qint32 id) {
+        for (int i = 0; i < m_Rules.size(); ++i) {
+            if (m_Rules.at(i).id == id) {
+                m_Rules.remove(i);
+                compile();
+                return;
+            }
+        }
+    }
+
+    ///
+    ///  @fn        clear
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalHighlighter::clear() {
+        m_Rules.clear();
+        compile();
+    }
+
+    ///
+    ///  @fn        isEmpty
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalHighlighter::isEmpty() const {
+        return m_Rules.isEmpty();
+    }
+
+    ///
+    ///  @fn        match
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalHighlighter::match(const QChar *data, qint32 length, QVector<Span> &spans, qint32 from) const {
+        QVector<Candidate> candidates;
+        spans.clear();
+
+        // Runs the automaton; case-sensitive rules are verified on a hit
+        if (m_States.size() > 1) {
+            qint32 s = 0;
+            for (qint32 i = from; i < length; ++i) {
+                ushort c = fold(data[i].unicode());
+                s = (c < 128) ? m_States.at(s).next[c] : wideTransition(s, c);
+
+                qint32 t = (m_States.at(s).output >= 0) ? s : m_States.at(s).dictionary;
+                for (; t >= 0; t = m_States.at(t).dictionary) {
+                    for (qint32 r = m_States.at(t).output; r >= 0; r = m_Rules.at(r).next) {
+                        const Rule &rule = m_Rules.at(r);
+                        qint32 start = i + 1 - rule.pattern.size();
+                        if (rule.cs == Qt::CaseSensitive && std::memcmp(data + start,
+                                rule.pattern.constData(), rule.pattern.size() * sizeof(QChar)) != 0)
+                            continue;
+
+                        Candidate candidate = { start, rule.pattern.size(), r, rule.style };
+                        candidates.append(candidate);
+                    }
+                }
+            }
+        }
+
+        // Runs the alternation of all joinable expressions at once
+        const QString subject = QString::fromRawData(data, length);
+        if (!m_ExpressionRules.isEmpty()) {
+            QRegularExpressionMatchIterator it = m_Expression.globalMatch(subject, from);
+            while (it.hasNext()) {
+                QRegularExpressionMatch m = it.next();
+                if (m.capturedLength() == 0)
+                    continue;
+
+                for (int k = 0; k < m_ExpressionRules.size(); ++k) {
+                    qint32 r = m_ExpressionRules.at(k);
+                    if (m.capturedStart(m_Rules.at(r).group) < 0)
+                        continue;
+
+                    Candidate candidate = { m.capturedStart(), m.capturedLength(), r, m_Rules.at(r).style };
+                    candidates.append(candidate);
+
+                    // Rules before this one did not match here, later ones may match longer
+                    for (int l = k + 1; l < m_ExpressionRules.size(); ++l) {
+                        QRegularExpressionMatch a = m_JoinedExpressions.at(l).match(subject, candidate.start,
+                                QRegularExpression::NormalMatch, QRegularExpression::AnchoredMatchOption);
+                        if (a.capturedLength() > candidate.length) {
+                            qint32 s = m_ExpressionRules.at(l);
+                            Candidate longer = { candidate.start, a.capturedLength(), s, m_Rules.at(s).style };
+                            candidates.append(longer);
+                        }
+                    }
+                    break;
+                }
+            }
+        }
+
+        // Runs the expressions that could not be joined one by one
+        for (int i = 0; i < m_SeparateRules.size(); ++i) {
+            qint32 r = m_SeparateRules.at(i);
+            QRegularExpressionMatchIterator it = m_SeparateExpressions.at(i).globalMatch(subject, from);
+            while (it.hasNext()) {
+                QRegularExpressionMatch m = it.next();
+                if (m.capturedLength() == 0)
+                    continue;
+
+                Candidate candidate = { m.capturedStart(), m.capturedLength(), r, m_Rules.at(r).style };
+                candidates.append(candidate);
+            }
+        }
+
+        // Keeps the leftmost, then longest match of overlapping ones
+        std::sort(candidates.begin(), candidates.end(), isPreferred);
+        qint32 end = 0;
+        for (const Candidate &candidate : candidates) {
+            if (candidate.start >= end) {
+                Span span = { candidate.start, candidate.length, candidate.style };
+                spans.append(span);
+                end = candidate.start + candidate.length;
+            }
+        }
+    }
+
+
+    ///
+    ///  @fn        compile
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalHighlighter::compile() {
+        compileLiterals();
+        return compileExpressions();
+    }
+
+    ///
+    ///  @fn        compileLiterals
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalHighlighter::compileLiterals() {
+        State root;
+        std::fill(root.next, root.next + 128, -1);
+        root.fail = 0;
+        root.output = -1;
+        root.dictionary = -1;
+
+        m_States.clear();
+        m_States.append(root);
+        m_WideEdges.clear();
+
+        // Builds the trie; remembers the non-ASCII edges of every state
+        QVector<QVector<qint32>> wideChildren(1);
+        for (int r = 0; r < m_Rules.size(); ++r) {
+            Rule &rule = m_Rules[r];
+            rule.next = -1;
+            if (rule.syntax != PatternSyntax::Literal)
+                continue;
+
+            qint32 s = 0;
+            for (QChar ch : rule.pattern) {
+                ushort c = fold(ch.unicode());
+                qint32 t = (c < 128) ? m_States.at(s).next[c] : m_WideEdges.value(edgeKey(s, c), -1);
+                if (t < 0) {
+                    t = m_States.size();
+                    m_States.append(root);
+                    wideChildren.append(QVector<qint32>());
+                    if (c < 128) {
+                        m_States[s].next[c] = t;
+                    } else {
+                        m_WideEdges.insert(edgeKey(s, c), t);
+                        wideChildren[s].append(c);
+                    }
+                }
+                s = t;
+            }
+
+            // Rules with the same folded text are chained in order
+            qint32 *last = &m_States[s].output;
+            while (*last >= 0)
+                last = &m_Rules[*last].next;
+            *last = r;
+        }
+
+        // Computes the fail links breadth-first and completes the ASCII table
+        QVector<qint32> queue;
+        for (int c = 0; c < 128; ++c) {
+            qint32 t = m_States.at(0).next[c];
+            if (t < 0) {
+                m_States[0].next[c] = 0;
+            } else {
+                queue.append(t);
+            }
+        }
+        for (qint32 c : wideChildren.at(0))
+            queue.append(m_WideEdges.value(edgeKey(0, static_cast<ushort>(c))));
+
+        for (int i = 0; i < queue.size(); ++i) {
+            qint32 s = queue.at(i);
+            State &state = m_States[s];
+            const State &fail = m_States.at(state.fail);
+            state.dictionary = (fail.output >= 0) ? state.fail : fail.dictionary;
+
+            for (int c = 0; c < 128; ++c) {
+                qint32 t = state.next[c];
+                if (t < 0) {
+                    state.next[c] = fail.next[c];
+                } else {
+                    m_States[t].fail = fail.next[c];
+                    queue.append(t);
+                }
+            }
+            for (qint32 c : wideChildren.at(s)) {
+                qint32 t = m_WideEdges.value(edgeKey(s, static_cast<ushort>(c)));
+                m_States[t].fail = wideTransition(state.fail, static_cast<ushort>(c));
+                queue.append(t);
+            }
+        }
+    }
+
+    ///
+    ///  @fn        compileExpressions
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalHighlighter::compileExpressions() {
+        QString joined;
+        qint32 group = 1;
+
+        // Every joinable rule becomes one capturing group of the alternation
+        m_ExpressionRules.clear();
+        m_JoinedExpressions.clear();
+        m_SeparateRules.clear();
+        m_SeparateExpressions.clear();
+        for (int r = 0; r < m_Rules.size(); ++r) {
+            Rule &rule = m_Rules[r];
+            if (rule.syntax != PatternSyntax::RegularExpression)
+                continue;
+
+            QRegularExpression::PatternOptions options = QRegularExpression::MultilineOption;
+            if (rule.cs == Qt::CaseInsensitive)
+                options |= QRegularExpression::CaseInsensitiveOption;
+            if (!isJoinable(rule.pattern)) {
+                rule.group = 0;
+                m_SeparateRules.append(r);
+                m_SeparateExpressions.append(QRegularExpression(rule.pattern, options));
+                continue;
+            }
+
+            if (!joined.isEmpty())
+                joined += QLatin1Char('|');
+
+            joined += (rule.cs == Qt::CaseSensitive) ? QLatin1String("(") : QLatin1String("((?i)");
+            joined += rule.pattern;
+            joined += QLatin1Char(')');
+
+            // Also compiled alone, to retry it where an earlier rule matched
+            QRegularExpression alone(rule.pattern, options);
+            rule.group = group;
+            group += 1 + alone.captureCount();
+            m_ExpressionRules.append(r);
+            m_JoinedExpressions.append(alone);
+        }
+
+        m_Expression.setPattern(joined);
+        m_Expression.setPatternOptions(QRegularExpression::MultilineOption);
+        return m_Expression.isValid();
+    }
+
+    ///
+    ///  @fn        isJoinable
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalHighlighter::isJoinable(const QString &pattern) {
+        const ushort *p = pattern.utf16();
+        const int size = pattern.size();
+
+        // Rejects everything that refers to groups by number or name,
+        // recursion, and constructs that may swallow the closing group
+        for (int i = 0; i < size; ++i) {
+            ushort n = (i + 1 < size) ? p[i + 1] : 0;
+            if (p[i] == '\\') {
+                if ((n >= '1' && n <= '9') || n == 'g' || n == 'k' || n == 'Q')
+                    return false;
+
+                ++i;
+            } else if (p[i] == '(' && n == '?') {
+                ushort h0 = (i + 2 < size) ? p[i + 2] : 0;
+                ushort h1 = (i + 3 < size) ? p[i + 3] : 0;
+                if (h0 == 'P' || h0 == 'R' || h0 == '&' || h0 == '\'' || h0 == '+' || (h0 >= '0' && h0 <= '9'))
+                    return false;
+                if (h0 == '<' && h1 != '=' && h1 != '!')
+                    return false;
+                if (h0 == '-' && h1 >= '0' && h1 <= '9')
+                    return false;
+
+                // Extended mode turns the rest of a line into a comment
+                for (int j = i + 2; j < size && ((p[j] >= 'a' && p[j] <= 'z') || (p[j] >= 'A' && p[j] <= 'Z')); ++j) {
+                    if (p[j] == 'x')
+                        return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    ///
+    ///  @fn        wideTransition
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint32 QTerminalHighlighter::wideTransition(qint32 state, ushort c) const {
+        forever {
+            qint32 t = m_WideEdges.value(edgeKey(state, c), -1);
+            if (t >= 0)
+                return t;
+            if (state == 0)
+                return 0;
+
+            state = m_States.at(state).fail;
+        }
+    }
+
+    ///
+    ///  @fn        fold
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    ushort QTerminalHighlighter::fold(ushort c) {
+        if (c < 128)
+            return (c >= 'A' && c <= 'Z') ? static_cast<ushort>(c + 32) : c;
+
+        return QChar(c).toLower().unicode();
+    }
+}
@@ -0,0 +1,489 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+
+//
+//  Included headers
+//
+#include <KGL/Core/QTerminalLog.hpp>
+#include <QMutexLocker>
+
+
+namespace kgl {
+
+    //
+    //  Encoding helpers
+    //
+    namespace {
+        const char *const HtmlHeader =
+                "<!DOCTYPE html>\n<html><head><meta charset=\"utf-8\"><style>"
+                "body{background:#1e1e1e;color:#d4d4d4}"
+                ".error{color:#f44747}.success{color:#6a9955}.warning{color:#d7ba7d}"
+                ".highlight{filter:invert(100%)}"
+                "</style></head><body><pre>";
+        const char *const HtmlFooter = "</pre></body></html>\n";
+        const char *const StateClasses[] = { "normal", "error", "success", "warning" };
+        const char *const StateColors[] = { "39", "31", "32", "33" };
+
+        bool operator!=(const QAnsiParser::Attributes &a, const QAnsiParser::Attributes &b) {
+            return a.state != b.state || a.foreground != b.foreground ||
+                   a.background != b.background || a.bold != b.bold ||
+                   a.underline != b.underline || a.inverse != b.inverse;
+        }
+
+        void appendColor(quint32 argb, QByteArray &out) {
+            out += QByteArray::number(argb & 0xffffff, 16).rightJustified(6, '0');
+        }
+    }
+
+
+    ///
+    ///  @fn        Default constructor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalLog::QTerminalLog()
+        : m_Encoding(LogEncoding::Plain)
+        , m_MaximumSize(0)
+        , m_FileSize(0)
+        , m_MaximumQueued(Q_INT64_C(8) << 20)
+        , m_Queued(0)
+        , m_Dropped(0)
+        , m_DroppedTotal(0)
+        , m_MaximumFiles(5)
+        , m_HasLast(false)
+        , m_Stop(false) {
+    }
+
+    ///
+    ///  @fn        Destructor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalLog::~QTerminalLog() {
+        close();
+        wait();
+    }
+
+
+    ///
+    ///  @fn        open
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalLog::open(const QString &path, LogEncoding encoding) {
+        close();
+        wait();
+
+        m_Path = path;
+        m_Encoding = encoding;
+        m_Stop = false;
+        m_Error.clear();
+        start(QThread::LowPriority);
+    }
+
+    ///
+    ///  @fn        close
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalLog::close() {
+        QMutexLocker lock(&m_Mutex);
+        m_Stop = true;
+        m_Condition.wakeOne();
+    }
+
+    ///
+    ///  @fn        setRotation
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalLog::setRotation(qint64 maximumSize, int maximumFiles) {
+        QMutexLocker lock(&m_Mutex);
+        m_MaximumSize = qMax(maximumSize, Q_INT64_C(0));
+        m_MaximumFiles = qMax(maximumFiles, 1);
+    }
+
+    ///
+    ///  @fn        setMaximumQueuedBytes
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalLog::setMaximumQueuedBytes(qint64 bytes) {
+        QMutexLocker lock(&m_Mutex);
+        m_MaximumQueued = qMax(bytes, Q_INT64_C(0));
+    }
+
+    ///
+    ///  @fn        droppedBytes
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint64 QTerminalLog::droppedBytes() const {
+        QMutexLocker lock(&m_Mutex);
+        return m_DroppedTotal;
+    }
+
+    ///
+    ///  @fn        errorString
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QString QTerminalLog::errorString() const {
+        QMutexLocker lock(&m_Mutex);
+        return m_Error;
+    }
+
+    ///
+    ///  @fn        append
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalLog::append(const QString &text, const QAnsiParser::Attributes &attributes) {
+        const qint64 bytes = text.size() * qint64(sizeof(QChar));
+        QMutexLocker lock(&m_Mutex);
+
+        // Drops output rather than waiting for a stalled disk
+        if (m_Stop || !isRunning() || m_Queued + bytes > m_MaximumQueued) {
+            if (!m_Stop && isRunning()) {
+                m_Dropped += bytes;
+                m_DroppedTotal += bytes;
+            }
+            return;
+        }
+
+        Record record;
+        record.text = text;
+        record.attributes = attributes;
+        m_Records.append(record);
+        m_Queued += bytes;
+
+        // Wakes the thread only for the first record of a batch
+        if (m_Records.size() == 1)
+            m_Condition.wakeOne();
+    }
+
+
+    ///
+    ///  @fn        run
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalLog::run() {
+        if (!openFile())
+            return;
+
+        QVector<Record> batch;
+        QByteArray out;
+
+        forever {
+            qint64 dropped;
+            bool stop;
+            {
+                QMutexLocker lock(&m_Mutex);
+                while (m_Records.isEmpty() && m_Dropped == 0 && !m_Stop)
+                    m_Condition.wait(&m_Mutex);
+
+                // Takes everything queued so far in one swap
+                batch.swap(m_Records);
+                dropped = m_Dropped;
+                stop = m_Stop;
+                m_Queued = 0;
+                m_Dropped = 0;
+            }
+
+            qint64 maximumSize;
+            {
+                QMutexLocker lock(&m_Mutex);
+                maximumSize = m_MaximumSize;
+            }
+
+            if (dropped > 0) {
+                QString note = QString("\n[%1 characters of output dropped]\n").arg(dropped / qint64(sizeof(QChar)));
+                QAnsiParser::Attributes a = { TextState::Warning, 0, 0, false, false, false };
+                Record record = { note, a };
+                encodeSplit(record, maximumSize, out);
+            }
+            for (const Record &record : batch)
+                encodeSplit(record, maximumSize, out);
+
+            batch.clear();
+
+            // One large sequential write per batch, unless it was split
+            writeOut(out);
+            if (maximumSize > 0 && m_FileSize >= maximumSize)
+                rotate();
+
+            if (stop)
+                break;
+        }
+
+        closeFile();
+    }
+
+    ///
+    ///  @fn        openFile
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalLog::openFile() {
+        m_File.setFileName(m_Path);
+        m_HasLast = false;
+
+        // HTML is read back to find the footer of a previous session
+        QIODevice::OpenMode mode = QIODevice::Unbuffered;
+        if (m_Encoding == LogEncoding::Html)
+            mode |= QIODevice::ReadWrite;
+        else
+            mode |= QIODevice::WriteOnly | QIODevice::Append;
+
+        if (!m_File.open(mode)) {
+            QMutexLocker lock(&m_Mutex);
+            m_Error = m_File.errorString();
+            m_Stop = true;
+            m_Records.clear();
+            return false;
+        }
+
+        m_FileSize = m_File.size();
+        if (m_Encoding == LogEncoding::Html) {
+            const qint64 footer = qstrlen(HtmlFooter);
+            if (m_FileSize == 0) {
+                m_FileSize = m_File.write(HtmlHeader);
+            } else if (m_FileSize >= footer && m_File.seek(m_FileSize - footer) && m_File.read(footer) == HtmlFooter) {
+                // Continues the document where its footer was
+                m_FileSize -= footer;
+                m_File.resize(m_FileSize);
+            }
+
+            m_File.seek(m_FileSize);
+        }
+
+        return true;
+    }
+
+    ///
+    ///  @fn        closeFile
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalLog::closeFile() {
+        // Closes the open span or resets the rendition for the next reader
+        if (m_Encoding == LogEncoding::Html) {
+            if (m_HasLast)
+                m_File.write("</span>");
+            m_File.write(HtmlFooter);
+        } else if (m_Encoding == LogEncoding::Ansi && m_HasLast) {
+            m_File.write("\x1b[0m");
+        }
+
+        m_File.close();
+    }
+
+    ///
+    ///  @fn        rotate
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalLog::rotate() {
+        int files;
+        {
+            QMutexLocker lock(&m_Mutex);
+            files = m_MaximumFiles;
+        }
+
+        closeFile();
+
+        // Shifts 'path' to 'path.1', 'path.1' to 'path.2' and so forth
+        QFile::remove(m_Path + QLatin1Char('.') + QString::number(files - 1));
+        for (int i = files - 2; i >= 1; --i) {
+            QFile::rename(m_Path + QLatin1Char('.') + QString::number(i),
+                          m_Path + QLatin1Char('.') + QString::number(i + 1));
+        }
+        if (files > 1)
+            QFile::rename(m_Path, m_Path + QLatin1String(".1"));
+        else
+            QFile::remove(m_Path);
+
+        openFile();
+    }
+
+    ///
+    ///  @fn        writeOut
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalLog::writeOut(QByteArray &out) {
+        if (out.isEmpty())
+            return;
+
+        qint64 written = m_File.write(out);
+        if (written != out.size()) {
+            QMutexLocker lock(&m_Mutex);
+            m_Error = m_File.errorString();
+        }
+
+        m_FileSize += qMax(written, Q_INT64_C(0));
+        out.clear();
+    }
+
+    ///
+    ///  @fn        encodeSplit
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalLog::encodeSplit(const Record &record, qint64 maximumSize, QByteArray &out) {
+        const QString &text = record.text;
+        qint32 position = 0;
+        bool rotated = false;
+
+        while (position < text.size()) {
+            // A new file takes at least one part, however small the limit
+            qint64 room = maximumSize - m_FileSize - out.size();
+            if (maximumSize > 0 && room <= 0 && !rotated) {
+                writeOut(out);
+                rotate();
+                if (!m_File.isOpen())
+                    return;
+
+                rotated = true;
+                continue;
+            }
+
+            rotated = false;
+
+            // A character takes six bytes at most once encoded, as '&quot;'
+            qint32 count = text.size() - position;
+            if (maximumSize > 0 && room / 6 < count)
+                count = qMax(static_cast<qint32>(room / 6), 1);
+            if (position + count < text.size() && text.at(position + count - 1).isHighSurrogate())
+                count++;
+
+            if (count == text.size()) {
+                encode(record, out);
+            } else {
+                Record part = { text.mid(position, count), record.attributes };
+                encode(part, out);
+            }
+
+            position += count;
+        }
+    }
+
+    ///
+    ///  @fn        encode
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalLog::encode(const Record &record, QByteArray &out) {
+        const QAnsiParser::Attributes &a = record.attributes;
+        if (m_Encoding == LogEncoding::Plain) {
+            out += record.text.toUtf8();
+            return;
+        }
+
+        // Emits a style change only where the style actually changes
+        if (!m_HasLast || a != m_Last) {
+            if (m_Encoding == LogEncoding::Ansi) {
+                encodeAnsi(a, out);
+            } else {
+                if (m_HasLast)
+                    out += "</span>";
+                encodeHtml(a, out);
+            }
+
+            m_Last = a;
+            m_HasLast = true;
+        }
+
+        if (m_Encoding == LogEncoding::Ansi) {
+            out += record.text.toUtf8();
+        } else {
+            out += record.text.toHtmlEscaped().toUtf8();
+        }
+    }
+
+    ///
+    ///  @fn        encodeAnsi
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalLog::encodeAnsi(const QAnsiParser::Attributes &a, QByteArray &out) {
+        out += "\x1b[0";
+        if (a.bold)      out += ";1";
+        if (a.underline) out += ";4";
+        if (a.inverse)   out += ";7";
+
+        if (a.foreground != 0) {
+            out += ";38;2;";
+            out += QByteArray::number((a.foreground >> 16) & 0xff) + ';';
+            out += QByteArray::number((a.foreground >> 8) & 0xff) + ';';
+            out += QByteArray::number(a.foreground & 0xff);
+        } else if (a.state != TextState::Normal) {
+            out += ';';
+            out += StateColors[static_cast<int>(a.state)];
+        }
+        if (a.background != 0) {
+            out += ";48;2;";
+            out += QByteArray::number((a.background >> 16) & 0xff) + ';';
+            out += QByteArray::number((a.background >> 8) & 0xff) + ';';
+            out += QByteArray::number(a.background & 0xff);
+        }
+
+        out += 'm';
+    }
+
+    ///
+    ///  @fn        encodeHtml
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalLog::encodeHtml(const QAnsiParser::Attributes &a, QByteArray &out) {
+        out += "<span class=\"";
+        out += StateClasses[static_cast<int>(a.state)];
+        if (a.inverse)
+            out += " highlight";
+        out += '"';
+
+        if (a.foreground != 0 || a.background != 0 || a.bold || a.underline) {
+            out += " style=\"";
+            if (a.foreground != 0) {
+                out += "color:#";
+                appendColor(a.foreground, out);
+                out += ';';
+            }
+            if (a.background != 0) {
+                out += "background:#";
+                appendColor(a.background, out);
+                out += ';';
+            }
+            if (a.bold)
+                out += "font-weight:bold;";
+            if (a.underline)
+                out += "text-decoration:underline;";
+            out += '"';
+        }
+
+        out += '>';
+    }
+}
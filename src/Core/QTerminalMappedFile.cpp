@@ -0,0 +1,334 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+
+//
+//  Included headers
+//
+#include <KGL/Core/QTerminalMappedFile.hpp>
+#include <QMutexLocker>
+#include <cstring>
+
+
+namespace kgl {
+
+    //
+    //  Collects the spans of one line into runs
+    //
+    namespace {
+        const qint64 PublishInterval = Q_INT64_C(4) << 20;
+
+        struct LineHandler : public QAnsiParser::Handler {
+            std::function<quint16(const QAnsiParser::Attributes &)> resolve;
+            QTerminalLineSource::Line *line;
+            quint16 style;
+
+            void text(const QChar *data, qint32 length) {
+                QVector<QTerminalLineSource::Run> &runs = line->runs;
+                if (!runs.isEmpty() && runs.last().style == style) {
+                    runs.last().length += length;
+                } else {
+                    QTerminalLineSource::Run run = { line->text.size(), length, style };
+                    runs.append(run);
+                }
+
+                line->text.append(data, length);
+            }
+
+            void attributes(const QAnsiParser::Attributes &attributes) {
+                style = resolve(attributes);
+            }
+        };
+    }
+
+
+    ///
+    ///  @fn        Default constructor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalMappedFile::QTerminalMappedFile()
+        : m_CacheFirst(0),
+          m_Data(NULL),
+          m_Size(0),
+          m_LineCount(0),
+          m_MaximumLength(0),
+          m_Stop(0),
+          m_IsIndexed(false) {
+    }
+
+    ///
+    ///  @fn        Destructor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalMappedFile::~QTerminalMappedFile() {
+        close();
+    }
+
+
+    ///
+    ///  @fn        open
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalMappedFile::open(const QString &path) {
+        close();
+
+        m_File.setFileName(path);
+        if (!m_File.open(QIODevice::ReadOnly)) {
+            m_Error = m_File.errorString();
+            return false;
+        }
+
+        // An empty file can not be mapped, but is a valid file
+        m_Size = m_File.size();
+        if (m_Size > 0) {
+            m_Data = m_File.map(0, m_Size);
+            if (m_Data == NULL) {
+                m_Error = m_File.errorString();
+                m_File.close();
+                m_Size = 0;
+                return false;
+            }
+        }
+
+        m_Error.clear();
+        m_Stop.storeRelease(0);
+        start(QThread::LowPriority);
+        return true;
+    }
+
+    ///
+    ///  @fn        close
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalMappedFile::close() {
+        m_Stop.storeRelease(1);
+        wait();
+
+        if (m_Data != NULL) {
+            m_File.unmap(const_cast<uchar *>(m_Data));
+            m_Data = NULL;
+        }
+
+        m_File.close();
+        m_Size = 0;
+        m_LineCount = 0;
+        m_MaximumLength = 0;
+        m_IsIndexed = false;
+        m_Checkpoints.clear();
+        m_Cache.clear();
+        m_CacheFirst = 0;
+    }
+
+    ///
+    ///  @fn        isIndexed
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalMappedFile::isIndexed() const {
+        QMutexLocker lock(&m_Mutex);
+        return m_IsIndexed;
+    }
+
+    ///
+    ///  @fn        size
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint64 QTerminalMappedFile::size() const {
+        return m_Size;
+    }
+
+    ///
+    ///  @fn        errorString
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QString QTerminalMappedFile::errorString() const {
+        return m_Error;
+    }
+
+    ///
+    ///  @fn        setStyleResolver
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalMappedFile::setStyleResolver(const StyleResolver &resolver) {
+        QMutexLocker lock(&m_Mutex);
+        m_Resolver = resolver;
+        m_Cache.clear();
+    }
+
+
+    ///
+    ///  @fn        lineCount
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint64 QTerminalMappedFile::lineCount() const {
+        QMutexLocker lock(&m_Mutex);
+        return m_LineCount;
+    }
+
+    ///
+    ///  @fn        line
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    const QTerminalLineSource::Line &QTerminalMappedFile::line(qint64 index) const {
+        QMutexLocker lock(&m_Mutex);
+        if (index < m_CacheFirst || index >= m_CacheFirst + m_Cache.size()) {
+            // Decodes a window around 'index' that starts at a checkpoint,
+            // leaving some lines above it for scrolling up
+            qint64 first = qMax(Q_INT64_C(0), index - CacheLines / 4);
+            first -= first % IndexInterval;
+
+            qint64 offset = m_Checkpoints.at(static_cast<int>(first / IndexInterval));
+            int count = static_cast<int>(qMin<qint64>(CacheLines, m_LineCount - first));
+            m_Cache.resize(count);
+            m_CacheFirst = first;
+
+            for (int i = 0; i < count; ++i) {
+                qint64 end = lineEnd(offset);
+                decode(offset, end, m_Cache[i]);
+                offset = end + 1;
+            }
+        }
+
+        return m_Cache.at(static_cast<int>(index - m_CacheFirst));
+    }
+
+    ///
+    ///  @fn        maximumLength
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint32 QTerminalMappedFile::maximumLength() const {
+        QMutexLocker lock(&m_Mutex);
+        return m_MaximumLength;
+    }
+
+
+    ///
+    ///  @fn        run
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalMappedFile::run() {
+        QVector<qint64> checkpoints;
+        qint64 position = 0, lines = 0, publish = PublishInterval;
+        qint32 longest = 0;
+
+        while (position < m_Size) {
+            if (lines % IndexInterval == 0) {
+                checkpoints.append(position);
+            }
+
+            qint64 end = lineEnd(position);
+            longest = qMax(longest, static_cast<qint32>(qMin<qint64>(end - position, MaximumLineLength)));
+            position = end + 1;
+            ++lines;
+
+            // Publishes complete lines every few megabytes
+            if (position >= publish || position >= m_Size) {
+                QMutexLocker lock(&m_Mutex);
+                m_Checkpoints += checkpoints;
+                m_LineCount = lines;
+                m_MaximumLength = longest;
+                checkpoints.clear();
+                publish = position + PublishInterval;
+
+                if (m_Stop.loadAcquire()) {
+                    return;
+                }
+            }
+        }
+
+        QMutexLocker lock(&m_Mutex);
+        m_IsIndexed = true;
+    }
+
+    ///
+    ///  @fn        lineEnd
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint64 QTerminalMappedFile::lineEnd(qint64 offset) const {
+        const char *data = reinterpret_cast<const char *>(m_Data);
+        const void *feed = std::memchr(data + offset, '\n', static_cast<size_t>(m_Size - offset));
+        return feed ? static_cast<const char *>(feed) - data : m_Size;
+    }
+
+    ///
+    ///  @fn        decode
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalMappedFile::decode(qint64 offset, qint64 end, Line &line) const {
+        qint64 length = end - offset;
+        if (length > 0 && m_Data[end - 1] == '\r') {
+            --length;
+        }
+
+        QString text = QString::fromUtf8(reinterpret_cast<const char *>(m_Data) + offset,
+                static_cast<int>(qMin<qint64>(length, MaximumLineLength)));
+
+        line.runs.clear();
+        if (QAnsiParser::findEscape(text.constData(), text.constData() + text.size())
+                == text.constData() + text.size()) {
+            // Plain lines consist of one single run
+            line.text = text;
+            if (!text.isEmpty()) {
+                Run run = { 0, text.size(), resolve(m_Ansi.attributes()) };
+                line.runs.append(run);
+            }
+            return;
+        }
+
+        LineHandler handler;
+        handler.resolve = [this](const QAnsiParser::Attributes &a) { return resolve(a); };
+        handler.line = &line;
+        line.text.clear();
+
+        m_Ansi.reset();
+        handler.style = resolve(m_Ansi.attributes());
+        m_Ansi.parse(text.constData(), text.size(), handler);
+        m_Ansi.reset();
+    }
+
+    ///
+    ///  @fn        resolve
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    quint16 QTerminalMappedFile::resolve(const QAnsiParser::Attributes &attributes) const {
+        if (m_Resolver) {
+            return m_Resolver(attributes);
+        }
+
+        return static_cast<quint16>(static_cast<int>(attributes.state) * 2 + (attributes.inverse ? 1 : 0));
+    }
+}
@@ -0,0 +1,702 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+//
+//  Included headers
+//
+#include <KGL/Core/QTerminalProcess.hpp>
+#include <QFile>
+#ifdef Q_OS_WIN
+#include <QProcess>
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/wait.h>
+#include <termios.h>
+#include <unistd.h>
+#if defined(Q_OS_MAC)
+#include <util.h>
+#elif defined(Q_OS_FREEBSD)
+#include <libutil.h>
+#else
+#include <pty.h>
+#endif
+#endif
+
+
+namespace kgl {
+
+#ifndef Q_OS_WIN
+    namespace {
+
+        ///
+        ///  @fn    setFlags
+        ///  @brief Makes a descriptor close-on-exec and, optionally,
+        ///         non-blocking.
+        ///
+        void setFlags(int fd, bool isNonBlocking) {
+            fcntl(fd, F_SETFD, fcntl(fd, F_GETFD) | FD_CLOEXEC);
+            if (isNonBlocking)
+                fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        }
+
+        ///
+        ///  @fn    closePipe
+        ///  @brief Closes both ends of a pipe that are still open.
+        ///
+        void closePipe(int fds[2]) {
+            for (int i = 0; i < 2; i++) {
+                if (fds[i] >= 0)
+                    close(fds[i]);
+                fds[i] = -1;
+            }
+        }
+    }
+#endif
+
+
+    ///
+    ///  @fn        Default constructor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalProcess::QTerminalProcess()
+        : m_IsFinished(0),
+          m_Buffered(0),
+          m_MaximumBuffered(1024 * 1024),
+          m_Pid(-1),
+          m_ExitCode(0),
+          m_InputFd(-1),
+          m_OutputFd(-1),
+          m_ErrorFd(-1),
+          m_UsesPty(false),
+          m_IsStarted(false),
+          m_Stop(false) {
+        m_WakeFds[0] = m_WakeFds[1] = -1;
+    }
+
+    ///
+    ///  @fn        Destructor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalProcess::~QTerminalProcess() {
+        {
+            QMutexLocker lock(&m_Mutex);
+            m_Stop = true;
+            m_Condition.wakeAll();
+        }
+
+#ifndef Q_OS_WIN
+        wake();
+        wait();
+        closeDescriptors();
+#else
+        wait();
+#endif
+    }
+
+
+    ///
+    ///  @fn        start
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalProcess::start(const QString &program, const QStringList &arguments, bool usePty) {
+        m_Program = program;
+        m_Arguments = arguments;
+
+#ifdef Q_OS_WIN
+        Q_UNUSED(usePty)
+        m_UsesPty = false;
+        QThread::start();
+
+        // Waits until the thread knows whether the program started
+        QMutexLocker lock(&m_Mutex);
+        while (!m_IsStarted && m_Error.isEmpty())
+            m_Condition.wait(&m_Mutex);
+
+        return m_IsStarted;
+#else
+        m_UsesPty = usePty;
+        if (!startUnix())
+            return false;
+
+        m_IsStarted = true;
+        QThread::start();
+        return true;
+#endif
+    }
+
+    ///
+    ///  @fn        usesPty : const
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalProcess::usesPty() const {
+        return m_UsesPty;
+    }
+
+    ///
+    ///  @fn        isFinished : const
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalProcess::isFinished() const {
+        return m_IsFinished.loadAcquire() != 0;
+    }
+
+    ///
+    ///  @fn        exitCode : const
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    int QTerminalProcess::exitCode() const {
+        QMutexLocker lock(&m_Mutex);
+        return m_ExitCode;
+    }
+
+    ///
+    ///  @fn        errorString : const
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QString QTerminalProcess::errorString() const {
+        QMutexLocker lock(&m_Mutex);
+        return m_Error;
+    }
+
+    ///
+    ///  @fn        setMaximumBuffered
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalProcess::setMaximumBuffered(qint64 bytes) {
+        QMutexLocker lock(&m_Mutex);
+        m_MaximumBuffered = qMax(bytes, Q_INT64_C(4096));
+    }
+
+    ///
+    ///  @fn        setWindowSize
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalProcess::setWindowSize(int columns, int rows) {
+#ifdef Q_OS_WIN
+        Q_UNUSED(columns)
+        Q_UNUSED(rows)
+#else
+        if (!m_UsesPty || m_OutputFd < 0)
+            return;
+
+        // The kernel sends SIGWINCH to the child
+        struct winsize size;
+        memset(&size, 0, sizeof(size));
+        size.ws_col = static_cast<unsigned short>(qMax(columns, 1));
+        size.ws_row = static_cast<unsigned short>(qMax(rows, 1));
+        ioctl(m_OutputFd, TIOCSWINSZ, &size);
+#endif
+    }
+
+    ///
+    ///  @fn        setNotifier
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalProcess::setNotifier(const std::function<void()> &notifier) {
+        m_Notifier = notifier;
+    }
+
+    ///
+    ///  @fn        take
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalProcess::take(QVector<Chunk> &chunks) {
+        bool wasFull;
+        {
+            QMutexLocker lock(&m_Mutex);
+            chunks.clear();
+            chunks.swap(m_Chunks);
+            wasFull = m_Buffered >= m_MaximumBuffered;
+            m_Buffered = 0;
+            m_Condition.wakeAll();
+        }
+
+#ifndef Q_OS_WIN
+        // Resumes reading from the child
+        if (wasFull)
+            wake();
+#else
+        Q_UNUSED(wasFull)
+#endif
+    }
+
+    ///
+    ///  @fn        write
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalProcess::write(const QByteArray &data) {
+        {
+            QMutexLocker lock(&m_Mutex);
+            m_Input += data;
+        }
+
+#ifndef Q_OS_WIN
+        wake();
+#endif
+    }
+
+    ///
+    ///  @fn        append
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalProcess::append(const char *data, qint64 length, bool isError) {
+        QMutexLocker lock(&m_Mutex);
+
+        // Coalesces consecutive reads of the same stream
+        if (m_Chunks.isEmpty() || m_Chunks.last().isError != isError) {
+            Chunk chunk;
+            chunk.isError = isError;
+            m_Chunks.append(chunk);
+        }
+
+        m_Chunks.last().data.append(data, static_cast<int>(length));
+        m_Buffered += length;
+        return m_Buffered >= m_MaximumBuffered;
+    }
+
+    ///
+    ///  @fn        finish
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalProcess::finish(int exitCode) {
+        {
+            QMutexLocker lock(&m_Mutex);
+            m_ExitCode = exitCode;
+        }
+
+        m_IsFinished.storeRelease(1);
+        if (m_Notifier)
+            m_Notifier();
+    }
+
+
+#ifndef Q_OS_WIN
+    ///
+    ///  @fn        startUnix
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalProcess::startUnix() {
+        // Prepares everything the child needs before forking
+        QVector<QByteArray> strings;
+        QVector<char *> argv;
+        strings.append(QFile::encodeName(m_Program));
+        for (const QString &argument : m_Arguments)
+            strings.append(argument.toLocal8Bit());
+        for (QByteArray &string : strings)
+            argv.append(string.data());
+        argv.append(NULL);
+
+        // A failed exec reports its errno through this pipe, a successful
+        // one closes it
+        int status[2] = { -1, -1 };
+        int input[2] = { -1, -1 };
+        int output[2] = { -1, -1 };
+        int error[2] = { -1, -1 };
+        if (pipe(status) != 0 || pipe(m_WakeFds) != 0 || (!m_UsesPty &&
+                (pipe(input) != 0 || pipe(output) != 0 || pipe(error) != 0))) {
+            m_Error = QString::fromLocal8Bit(strerror(errno));
+            closePipe(status);
+            closePipe(input);
+            closePipe(output);
+            closePipe(error);
+            closeDescriptors();
+            return false;
+        }
+
+        setFlags(status[0], false);
+        setFlags(status[1], false);
+        setFlags(m_WakeFds[0], true);
+        setFlags(m_WakeFds[1], true);
+
+        pid_t pid;
+        int master = -1;
+        if (m_UsesPty) {
+            struct winsize size;
+            memset(&size, 0, sizeof(size));
+            size.ws_col = 80;
+            size.ws_row = 24;
+            pid = forkpty(&master, NULL, NULL, &size);
+        } else {
+            pid = fork();
+        }
+
+        if (pid == 0) {
+            if (m_UsesPty) {
+                // The terminal shows typed lines itself and expects '\n'
+                struct termios attributes;
+                if (tcgetattr(STDIN_FILENO, &attributes) == 0) {
+                    attributes.c_lflag &= ~ECHO;
+                    attributes.c_oflag &= ~OPOST;
+                    tcsetattr(STDIN_FILENO, TCSANOW, &attributes);
+                }
+            } else {
+                dup2(input[0], STDIN_FILENO);
+                dup2(output[1], STDOUT_FILENO);
+                dup2(error[1], STDERR_FILENO);
+                closePipe(input);
+                closePipe(output);
+                closePipe(error);
+            }
+
+            execvp(argv[0], argv.data());
+            int code = errno;
+            ssize_t written = ::write(status[1], &code, sizeof(code));
+            Q_UNUSED(written)
+            _exit(127);
+        }
+
+        close(status[1]);
+        if (!m_UsesPty) {
+            close(input[0]);
+            close(output[1]);
+            close(error[1]);
+        }
+
+        if (pid < 0) {
+            m_Error = QString::fromLocal8Bit(strerror(errno));
+            close(status[0]);
+            if (!m_UsesPty) {
+                close(input[1]);
+                close(output[0]);
+                close(error[0]);
+            }
+            closeDescriptors();
+            return false;
+        }
+
+        // Waits until the child either ran exec or failed to
+        int code = 0;
+        ssize_t length;
+        while ((length = read(status[0], &code, sizeof(code))) < 0 && errno == EINTR);
+        close(status[0]);
+
+        m_Pid = pid;
+        if (m_UsesPty) {
+            m_InputFd = master;
+            m_OutputFd = master;
+            setFlags(master, true);
+        } else {
+            m_InputFd = input[1];
+            m_OutputFd = output[0];
+            m_ErrorFd = error[0];
+            setFlags(m_InputFd, true);
+            setFlags(m_OutputFd, true);
+            setFlags(m_ErrorFd, true);
+        }
+
+        if (length > 0) {
+            m_Error = m_Program + ": " + QString::fromLocal8Bit(strerror(code));
+            reap();
+            closeDescriptors();
+            return false;
+        }
+
+        return true;
+    }
+
+    ///
+    ///  @fn        readDescriptor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalProcess::readDescriptor(int fd, bool isError) {
+        char buffer[65536];
+
+        // Reads until the pipe is empty, so one wake-up yields one chunk
+        forever {
+            ssize_t length = read(fd, buffer, sizeof(buffer));
+            if (length > 0) {
+                if (append(buffer, length, isError))
+                    return true;
+            } else if (length < 0 && errno == EINTR) {
+                continue;
+            } else if (length < 0 && errno == EAGAIN) {
+                return true;
+            } else {
+                // End of file; a pseudo-terminal reports EIO instead
+                return false;
+            }
+        }
+    }
+
+    ///
+    ///  @fn        writeInput
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalProcess::writeInput() {
+        QByteArray input;
+        {
+            QMutexLocker lock(&m_Mutex);
+            input = m_Input;
+        }
+
+        ssize_t length = ::write(m_InputFd, input.constData(), input.size());
+        QMutexLocker lock(&m_Mutex);
+        if (length > 0) {
+            m_Input.remove(0, static_cast<int>(length));
+        } else if (length < 0 && errno != EAGAIN && errno != EINTR) {
+            // The child closed its input
+            m_Input.clear();
+        }
+    }
+
+    ///
+    ///  @fn        reap
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalProcess::reap() {
+        int status = 0;
+        forever {
+            pid_t result = waitpid(static_cast<pid_t>(m_Pid), &status, WNOHANG);
+            if (result < 0 && errno == EINTR)
+                continue;
+            if (result != 0)
+                break;
+
+            // The child closed its output but keeps running
+            bool stop;
+            {
+                QMutexLocker lock(&m_Mutex);
+                stop = m_Stop || !m_IsStarted;
+            }
+            if (stop) {
+                kill(static_cast<pid_t>(m_Pid), SIGKILL);
+                while (waitpid(static_cast<pid_t>(m_Pid), &status, 0) < 0 && errno == EINTR);
+                break;
+            }
+
+            struct pollfd fd = { m_WakeFds[0], POLLIN, 0 };
+            if (poll(&fd, 1, 100) > 0) {
+                char drain[64];
+                while (read(m_WakeFds[0], drain, sizeof(drain)) > 0);
+            }
+        }
+
+        m_Pid = -1;
+        finish(WIFSIGNALED(status) ? 128 + WTERMSIG(status) : WEXITSTATUS(status));
+    }
+
+    ///
+    ///  @fn        wake
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalProcess::wake() {
+        if (m_WakeFds[1] < 0)
+            return;
+
+        char c = 0;
+        ssize_t length = ::write(m_WakeFds[1], &c, 1);
+        Q_UNUSED(length)
+    }
+
+    ///
+    ///  @fn        closeDescriptors
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalProcess::closeDescriptors() {
+        if (m_InputFd >= 0 && m_InputFd != m_OutputFd)
+            close(m_InputFd);
+        if (m_OutputFd >= 0)
+            close(m_OutputFd);
+        if (m_ErrorFd >= 0)
+            close(m_ErrorFd);
+
+        m_InputFd = m_OutputFd = m_ErrorFd = -1;
+        closePipe(m_WakeFds);
+    }
+
+    ///
+    ///  @fn        run
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalProcess::run() {
+        // Writing to a child that closed its input must not kill us
+        sigset_t signals;
+        sigemptyset(&signals);
+        sigaddset(&signals, SIGPIPE);
+        pthread_sigmask(SIG_BLOCK, &signals, NULL);
+
+        bool hasOutput = true;
+        bool hasError = m_ErrorFd >= 0;
+        while (hasOutput || hasError) {
+            bool isFull, hasInput;
+            {
+                QMutexLocker lock(&m_Mutex);
+                if (m_Stop)
+                    break;
+
+                isFull = m_Buffered >= m_MaximumBuffered;
+                hasInput = !m_Input.isEmpty();
+            }
+
+            // Leaves the output in the pipe while the buffer is full
+            struct pollfd fds[4];
+            int count = 0, output = -1, error = -1, input = -1;
+            fds[count++] = { m_WakeFds[0], POLLIN, 0 };
+            if (hasOutput && !isFull) {
+                output = count;
+                fds[count++] = { m_OutputFd, POLLIN, 0 };
+            }
+            if (hasError && !isFull) {
+                error = count;
+                fds[count++] = { m_ErrorFd, POLLIN, 0 };
+            }
+            if (hasInput) {
+                input = count;
+                fds[count++] = { m_InputFd, POLLOUT, 0 };
+            }
+
+            if (poll(fds, count, -1) < 0) {
+                if (errno == EINTR)
+                    continue;
+                break;
+            }
+
+            if (fds[0].revents) {
+                char drain[64];
+                while (read(m_WakeFds[0], drain, sizeof(drain)) > 0);
+            }
+
+            bool hasRead = false;
+            if (output >= 0 && fds[output].revents) {
+                hasOutput = readDescriptor(m_OutputFd, false);
+                hasRead = true;
+            }
+            if (error >= 0 && fds[error].revents) {
+                hasError = readDescriptor(m_ErrorFd, true);
+                hasRead = true;
+            }
+            if (input >= 0 && fds[input].revents) {
+                writeInput();
+            }
+
+            if (hasRead && m_Notifier)
+                m_Notifier();
+        }
+
+        reap();
+    }
+#else
+    ///
+    ///  @fn        run
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalProcess::run() {
+        runProcess();
+    }
+
+    ///
+    ///  @fn        runProcess
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalProcess::runProcess() {
+        QProcess process;
+        process.start(m_Program, m_Arguments);
+        bool isStarted = process.waitForStarted(-1);
+        {
+            QMutexLocker lock(&m_Mutex);
+            m_IsStarted = isStarted;
+            if (!isStarted)
+                m_Error = process.errorString();
+            m_Condition.wakeAll();
+        }
+        if (!isStarted)
+            return;
+
+        // QProcess only reads while waited on, which yields backpressure
+        forever {
+            QByteArray input;
+            bool isFull, stop;
+            {
+                QMutexLocker lock(&m_Mutex);
+                isFull = m_Buffered >= m_MaximumBuffered;
+                if (isFull && !m_Stop)
+                    m_Condition.wait(&m_Mutex, 50);
+
+                stop = m_Stop;
+                input.swap(m_Input);
+            }
+
+            if (stop) {
+                process.kill();
+                process.waitForFinished(-1);
+                break;
+            }
+            if (!input.isEmpty()) {
+                process.write(input);
+            }
+            if (isFull) {
+                continue;
+            }
+
+            bool isRunning = process.state() != QProcess::NotRunning;
+            if (isRunning) {
+                process.waitForReadyRead(50);
+            }
+
+            QByteArray output = process.readAllStandardOutput();
+            QByteArray error = process.readAllStandardError();
+            if (!output.isEmpty())
+                append(output.constData(), output.size(), false);
+            if (!error.isEmpty())
+                append(error.constData(), error.size(), true);
+
+            if (!output.isEmpty() || !error.isEmpty()) {
+                if (m_Notifier)
+                    m_Notifier();
+            } else if (!isRunning) {
+                break;
+            }
+        }
+
+        finish(process.exitCode());
+    }
+#endif
+}
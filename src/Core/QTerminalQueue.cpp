@@ -0,0 +1,121 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+//
+//  Included headers
+//
+#include <KGL/Core/QTerminalQueue.hpp>
+
+
+namespace kgl {
+
+    ///
+    ///  @fn        Default constructor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalQueue::QTerminalQueue()
+        : m_Head(&m_Stub),
+          m_Tail(&m_Stub) {
+        m_Stub.next.storeRelease(NULL);
+    }
+
+    ///
+    ///  @fn        Destructor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalQueue::~QTerminalQueue() {
+        Record record;
+        while (pop(record));
+    }
+
+
+    ///
+    ///  @fn        pushNode
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalQueue::pushNode(Node *node) {
+        node->next.storeRelease(NULL);
+
+        // Publishes the node; the link becomes visible to the consumer
+        // only after the release-store below
+        Node *prev = m_Head.fetchAndStoreOrdered(node);
+        prev->next.storeRelease(node);
+    }
+
+    ///
+    ///  @fn        push
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalQueue::push(const QString &text, TextState state, bool highlight) {
+        Node *node = new Node;
+        node->record.text = text;
+        node->record.state = state;
+        node->record.highlight = highlight;
+        pushNode(node);
+    }
+
+    ///
+    ///  @fn        pop
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalQueue::pop(Record &record) {
+        Node *tail = m_Tail;
+        Node *next = tail->next.loadAcquire();
+
+        // Skips the stub node
+        if (tail == &m_Stub) {
+            if (next == NULL) {
+                return false;
+            }
+
+            m_Tail = tail = next;
+            next = next->next.loadAcquire();
+        }
+
+        if (next == NULL) {
+            // A producer swapped the head but did not link it yet
+            if (tail != m_Head.loadAcquire()) {
+                return false;
+            }
+
+            // Re-inserts the stub so the last node can be released
+            pushNode(&m_Stub);
+            next = tail->next.loadAcquire();
+            if (next == NULL) {
+                return false;
+            }
+        }
+
+        m_Tail = next;
+        record.text.swap(tail->record.text);
+        record.state = tail->record.state;
+        record.highlight = tail->record.highlight;
+        delete tail;
+        return true;
+    }
+}
@@ -0,0 +1,391 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+
+//
+//  Included headers
+//
+#include <KGL/Core/QTerminalRecorder.hpp>
+#include <QMutexLocker>
+#include <climits>
+#include <cstring>
+
+
+namespace kgl {
+
+    //
+    //  File signature
+    //
+    namespace {
+        const char Magic[] = { 'Q', 'T', 'R', 'M' };
+        const int FlushThreshold = 64 * 1024;
+    }
+
+
+    ///
+    ///  @fn        Default constructor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalRecorder::QTerminalRecorder()
+        : m_LastTime(0),
+          m_IsOpen(false),
+          m_Stop(false) {
+    }
+
+    ///
+    ///  @fn        Destructor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalRecorder::~QTerminalRecorder() {
+        close();
+    }
+
+
+    ///
+    ///  @fn        open
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalRecorder::open(const QString &path) {
+        close();
+
+        m_File.setFileName(path);
+        if (!m_File.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            return false;
+        }
+
+        m_Buffer.append(Magic, sizeof(Magic));
+        m_Buffer.append(char(Version));
+        m_Strings.clear();
+        m_LastTime = 0;
+        m_Clock.start();
+        m_IsOpen = true;
+        m_Stop = false;
+
+        // From here on only the recorder's thread touches the file
+        start(QThread::LowPriority);
+        return true;
+    }
+
+    ///
+    ///  @fn        close
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalRecorder::close() {
+        if (!m_IsOpen)
+            return;
+
+        handOff(true);
+        {
+            QMutexLocker lock(&m_Mutex);
+            m_Stop = true;
+            m_Condition.wakeOne();
+        }
+
+        wait();
+        m_File.close();
+        m_Strings.clear();
+        m_IsOpen = false;
+    }
+
+    ///
+    ///  @fn        isOpen
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalRecorder::isOpen() const {
+        return m_IsOpen;
+    }
+
+    ///
+    ///  @fn        recordText
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalRecorder::recordText(const QString &text, TextState state, bool highlight) {
+        if (!m_IsOpen || text.isEmpty())
+            return;
+
+        // Repeated short texts are stored as a table index
+        QHash<QString, quint32>::const_iterator it = m_Strings.constFind(text);
+        if (it != m_Strings.constEnd()) {
+            writeHeader(TextRef, state, highlight);
+            writeVarint(it.value());
+        } else {
+            QByteArray bytes = text.toUtf8();
+            writeHeader(Text, state, highlight);
+            writeBytes(bytes);
+
+            if (bytes.size() <= MaximumInterned && m_Strings.size() < MaximumStrings)
+                m_Strings.insert(text, quint32(m_Strings.size()));
+        }
+
+        handOff(false);
+    }
+
+    ///
+    ///  @fn        recordInput
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalRecorder::recordInput(const QString &line, TextState state, bool highlight) {
+        if (!m_IsOpen)
+            return;
+
+        writeHeader(Input, state, highlight);
+        writeBytes(line.toUtf8());
+        handOff(false);
+    }
+
+    ///
+    ///  @fn        flush
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalRecorder::flush() {
+        if (m_IsOpen)
+            handOff(true);
+    }
+
+    ///
+    ///  @fn        run
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalRecorder::run() {
+        QVector<QByteArray> batch;
+        QByteArray out;
+
+        forever {
+            bool stop;
+            {
+                QMutexLocker lock(&m_Mutex);
+                while (m_Chunks.isEmpty() && !m_Stop)
+                    m_Condition.wait(&m_Mutex);
+
+                batch.swap(m_Chunks);
+                stop = m_Stop;
+            }
+
+            // Joins the chunks of many small flushes into one write
+            for (const QByteArray &chunk : batch)
+                out += chunk;
+
+            if (!out.isEmpty()) {
+                m_File.write(out);
+                m_File.flush();
+                out.clear();
+            }
+
+            batch.clear();
+            if (stop)
+                break;
+        }
+    }
+
+    ///
+    ///  @fn        writeHeader
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalRecorder::writeHeader(Kind kind, TextState state, bool highlight) {
+        const qint64 now = m_Clock.nsecsElapsed() / 1000;
+
+        m_Buffer.append(char(kind));
+        writeVarint(quint64(now - m_LastTime));
+        m_Buffer.append(char(static_cast<int>(state) * 2 + (highlight ? 1 : 0)));
+        m_LastTime = now;
+    }
+
+    ///
+    ///  @fn        writeVarint
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalRecorder::writeVarint(quint64 value) {
+        while (value >= 0x80) {
+            m_Buffer.append(char((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        m_Buffer.append(char(value));
+    }
+
+    ///
+    ///  @fn        writeBytes
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalRecorder::writeBytes(const QByteArray &bytes) {
+        writeVarint(quint64(bytes.size()));
+        m_Buffer.append(bytes);
+    }
+
+    ///
+    ///  @fn        handOff
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalRecorder::handOff(bool force) {
+        if (m_Buffer.isEmpty() || (!force && m_Buffer.size() < FlushThreshold))
+            return;
+
+        QMutexLocker lock(&m_Mutex);
+        m_Chunks.append(m_Buffer);
+        m_Buffer.clear();
+        m_Condition.wakeOne();
+    }
+
+
+    ///
+    ///  @fn        QTerminalReplay::QTerminalReplay
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalReplay::QTerminalReplay()
+        : m_Data(NULL),
+          m_Size(0),
+          m_Time(0),
+          m_Position(0) {
+    }
+
+    ///
+    ///  @fn        QTerminalReplay::open
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalReplay::open(const QString &path) {
+        m_File.close();
+        m_File.setFileName(path);
+        m_Buffer.clear();
+        m_Data = NULL;
+        m_Size = 0;
+
+        if (!m_File.open(QIODevice::ReadOnly))
+            return false;
+
+        // Maps the session instead of loading it; hours of output stay on disk
+        m_Size = m_File.size();
+        m_Data = reinterpret_cast<const char *>(m_File.map(0, m_Size));
+        if (m_Data == NULL) {
+            m_Buffer = m_File.readAll();
+            m_Data = m_Buffer.constData();
+            m_Size = m_Buffer.size();
+        }
+
+        if (m_Size < qint64(sizeof(Magic)) + 1 ||
+            std::memcmp(m_Data, Magic, sizeof(Magic)) != 0 ||
+            m_Data[sizeof(Magic)] != char(QTerminalRecorder::Version)) {
+            m_File.close();
+            m_Buffer.clear();
+            m_Data = NULL;
+            m_Size = 0;
+            return false;
+        }
+
+        rewind();
+        return true;
+    }
+
+    ///
+    ///  @fn        QTerminalReplay::rewind
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalReplay::rewind() {
+        m_Position = (m_Size == 0) ? 0 : qint64(sizeof(Magic)) + 1;
+        m_Time = 0;
+        m_Strings.clear();
+    }
+
+    ///
+    ///  @fn        QTerminalReplay::next
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalReplay::next(Event &event) {
+        quint64 delay, value;
+        if (m_Position >= m_Size)
+            return false;
+
+        const int kind = uchar(m_Data[m_Position++]);
+        if (!readVarint(delay) || m_Position >= m_Size)
+            return false;
+
+        const int style = uchar(m_Data[m_Position++]);
+        if (!readVarint(value))
+            return false;
+
+        m_Time += qint64(delay);
+        event.time = m_Time;
+        event.state = static_cast<TextState>((style / 2) & 3);
+        event.highlight = (style & 1) != 0;
+        event.isInput = kind == QTerminalRecorder::Input;
+
+        if (kind == QTerminalRecorder::TextRef) {
+            if (value >= quint64(m_Strings.size()))
+                return false;
+
+            event.text = m_Strings.at(int(value));
+            return true;
+        }
+
+        if (kind != QTerminalRecorder::Text && kind != QTerminalRecorder::Input)
+            return false;
+        if (value > quint64(m_Size - m_Position) || value > quint64(INT_MAX))
+            return false;
+
+        // Mirrors the interning rule of the recorder
+        event.text = QString::fromUtf8(m_Data + m_Position, int(value));
+        m_Position += qint64(value);
+        if (kind == QTerminalRecorder::Text &&
+            value <= quint64(QTerminalRecorder::MaximumInterned) &&
+            m_Strings.size() < QTerminalRecorder::MaximumStrings) {
+            m_Strings.append(event.text);
+        }
+
+        return true;
+    }
+
+    ///
+    ///  @fn        QTerminalReplay::readVarint
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalReplay::readVarint(quint64 &value) {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (m_Position >= m_Size)
+                return false;
+
+            const uchar byte = uchar(m_Data[m_Position++]);
+            value |= quint64(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+                return true;
+        }
+
+        return false;
+    }
+}
@@ -0,0 +1,331 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+
+//
+//  Included headers
+//
+#include <KGL/Core/QTerminalSearch.hpp>
+#include <QMutexLocker>
+#include <QRegularExpression>
+#include <QStringMatcher>
+#include <algorithm>
+
+
+namespace kgl {
+
+    //
+    //  Ordering of matches by position
+    //
+    namespace {
+        const int SliceLines = 4096;
+
+        bool isBefore(const QTerminalSearch::Match &a, const QTerminalSearch::Match &b) {
+            return a.line < b.line || (a.line == b.line && a.start < b.start);
+        }
+
+        bool isBeforeLine(const QTerminalSearch::Match &match, qint64 line) {
+            return match.line < line;
+        }
+    }
+
+
+    ///
+    ///  @fn        Default constructor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalSearch::QTerminalSearch()
+        : m_Generation(0),
+          m_IsRegex(false),
+          m_CaseSensitive(false),
+          m_IsValid(true),
+          m_Stop(false) {
+    }
+
+    ///
+    ///  @fn        Destructor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalSearch::~QTerminalSearch() {
+        {
+            QMutexLocker lock(&m_Mutex);
+            m_Stop = true;
+            m_Condition.wakeOne();
+        }
+
+        wait();
+    }
+
+
+    ///
+    ///  @fn        setPattern
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalSearch::setPattern(const QString &pattern, bool isRegex, bool caseSensitive) {
+        bool isValid = !isRegex || QRegularExpression(pattern).isValid();
+
+        QMutexLocker lock(&m_Mutex);
+        m_Pattern = pattern;
+        m_IsRegex = isRegex;
+        m_CaseSensitive = caseSensitive;
+        m_IsValid = isValid;
+        m_Generation++;
+        m_Jobs.clear();
+        m_Matches.clear();
+
+        if (!isRunning()) {
+            start(QThread::LowPriority);
+        }
+    }
+
+    ///
+    ///  @fn        pattern
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QString QTerminalSearch::pattern() const {
+        QMutexLocker lock(&m_Mutex);
+        return m_Pattern;
+    }
+
+    ///
+    ///  @fn        isValid
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalSearch::isValid() const {
+        QMutexLocker lock(&m_Mutex);
+        return m_IsValid;
+    }
+
+    ///
+    ///  @fn        append
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalSearch::append(qint64 first, const QVector<QString> &lines) {
+        Job job;
+        job.lines = lines;
+        job.first = first;
+
+        QMutexLocker lock(&m_Mutex);
+        if (m_Pattern.isEmpty() || !m_IsValid)
+            return;
+
+        m_Jobs.append(job);
+        m_Condition.wakeOne();
+    }
+
+    ///
+    ///  @fn        discardBefore
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalSearch::discardBefore(qint64 line) {
+        QMutexLocker lock(&m_Mutex);
+        QVector<Match>::iterator end = std::lower_bound(m_Matches.begin(), m_Matches.end(), line, isBeforeLine);
+        m_Matches.erase(m_Matches.begin(), end);
+    }
+
+    ///
+    ///  @fn        clear
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalSearch::clear() {
+        QMutexLocker lock(&m_Mutex);
+        m_Generation++;
+        m_Jobs.clear();
+        m_Matches.clear();
+    }
+
+    ///
+    ///  @fn        setNotifier
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalSearch::setNotifier(const std::function<void()> &notifier) {
+        QMutexLocker lock(&m_Mutex);
+        m_Notifier = notifier;
+    }
+
+
+    ///
+    ///  @fn        count
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint32 QTerminalSearch::count() const {
+        QMutexLocker lock(&m_Mutex);
+        return m_Matches.size();
+    }
+
+    ///
+    ///  @fn        matches
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QVector<QTerminalSearch::Match> QTerminalSearch::matches(qint64 first, qint64 last) const {
+        QMutexLocker lock(&m_Mutex);
+        QVector<Match>::const_iterator begin = std::lower_bound(m_Matches.constBegin(), m_Matches.constEnd(), first, isBeforeLine);
+        QVector<Match>::const_iterator end = std::lower_bound(begin, m_Matches.constEnd(), last + 1, isBeforeLine);
+
+        QVector<Match> result;
+        result.reserve(static_cast<int>(end - begin));
+        for (; begin != end; ++begin)
+            result.append(*begin);
+
+        return result;
+    }
+
+    ///
+    ///  @fn        find
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalSearch::find(qint64 line, qint32 column, bool backwards, Match &match) const {
+        QMutexLocker lock(&m_Mutex);
+        if (m_Matches.isEmpty())
+            return false;
+
+        Match position = { line, column, 0 };
+        if (backwards) {
+            QVector<Match>::const_iterator it = std::lower_bound(m_Matches.constBegin(), m_Matches.constEnd(), position, isBefore);
+            match = (it == m_Matches.constBegin()) ? m_Matches.last() : *(it - 1);
+        } else {
+            QVector<Match>::const_iterator it = std::upper_bound(m_Matches.constBegin(), m_Matches.constEnd(), position, isBefore);
+            match = (it == m_Matches.constEnd()) ? m_Matches.first() : *it;
+        }
+
+        return true;
+    }
+
+    ///
+    ///  @fn        indexOf
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint32 QTerminalSearch::indexOf(const Match &match) const {
+        QMutexLocker lock(&m_Mutex);
+        QVector<Match>::const_iterator it = std::lower_bound(m_Matches.constBegin(), m_Matches.constEnd(), match, isBefore);
+        if (it == m_Matches.constEnd() || it->line != match.line || it->start != match.start)
+            return -1;
+
+        return static_cast<qint32>(it - m_Matches.constBegin());
+    }
+
+
+    ///
+    ///  @fn        run
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalSearch::run() {
+        QRegularExpression regex;
+        QStringMatcher matcher;
+        quint32 compiled = 0;
+        bool isRegex = false;
+
+        forever {
+            Job job;
+            quint32 generation;
+            {
+                QMutexLocker lock(&m_Mutex);
+                while (m_Jobs.isEmpty() && !m_Stop)
+                    m_Condition.wait(&m_Mutex);
+                if (m_Stop)
+                    return;
+
+                job = m_Jobs.takeFirst();
+                generation = m_Generation;
+
+                // Compiles the pattern once per search
+                if (compiled != generation) {
+                    isRegex = m_IsRegex;
+                    if (isRegex) {
+                        regex.setPattern(m_Pattern);
+                        regex.setPatternOptions(m_CaseSensitive
+                                ? QRegularExpression::NoPatternOption
+                                : QRegularExpression::CaseInsensitiveOption);
+                    } else {
+                        matcher.setPattern(m_Pattern);
+                        matcher.setCaseSensitivity(m_CaseSensitive ? Qt::CaseSensitive : Qt::CaseInsensitive);
+                    }
+
+                    compiled = generation;
+                }
+            }
+
+            QVector<Match> found;
+            bool isReplaced = false;
+            for (int i = 0; i < job.lines.size(); ) {
+                // Searches a slice of lines without holding the lock
+                for (int end = qMin(job.lines.size(), i + SliceLines); i < end; ++i) {
+                    const QString &text = job.lines.at(i);
+                    Match match = { job.first + i, 0, 0 };
+                    if (isRegex) {
+                        QRegularExpressionMatchIterator it = regex.globalMatch(text);
+                        while (it.hasNext()) {
+                            QRegularExpressionMatch m = it.next();
+                            if (m.capturedLength() > 0) {
+                                match.start = m.capturedStart();
+                                match.length = m.capturedLength();
+                                found.append(match);
+                            }
+                        }
+                    } else {
+                        match.length = matcher.pattern().size();
+                        for (int at = matcher.indexIn(text); at >= 0; at = matcher.indexIn(text, at + match.length)) {
+                            match.start = at;
+                            found.append(match);
+                        }
+                    }
+                }
+
+                // Publishes the slice unless a new search started
+                std::function<void()> notifier;
+                {
+                    QMutexLocker lock(&m_Mutex);
+                    if (m_Generation != generation)
+                        break;
+
+                    if (!isReplaced) {
+                        QVector<Match>::iterator from = std::lower_bound(m_Matches.begin(), m_Matches.end(), job.first, isBeforeLine);
+                        m_Matches.erase(from, m_Matches.end());
+                        isReplaced = true;
+                    }
+
+                    m_Matches += found;
+                    notifier = m_Notifier;
+                }
+
+                found.clear();
+                if (notifier)
+                    notifier();
+            }
+        }
+    }
+}
@@ -0,0 +1,214 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+//
+//  Included headers
+//
+#include <KGL/Core/QTerminalStats.hpp>
+#include <QtAlgorithms>
+
+
+namespace kgl {
+
+    ///
+    ///  @fn        Default constructor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalStats::QTerminalStats()
+        : m_Characters(0),
+          m_Lines(0),
+          m_Posted(0),
+          m_Drained(0),
+          m_Reads(0),
+          m_ReadNsecs(0),
+          m_RateCharacters(0),
+          m_RateLines(0),
+          m_CharactersPerSecond(0.0),
+          m_LinesPerSecond(0.0) {
+        m_RateClock.start();
+    }
+
+
+    ///
+    ///  @fn        percentile : const
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint64 QTerminalStats::Histogram::percentile(double p) const {
+        qint64 rank = static_cast<qint64>(p * count);
+        qint64 seen = 0;
+        for (qint32 i = 0; i < HistogramBuckets; i++) {
+            seen += buckets[i];
+            if (seen > rank && i < HistogramBuckets - 1)
+                return Q_INT64_C(1) << i;
+        }
+
+        // The last bucket has no upper bound of its own
+        return maximumNsecs / 1000;
+    }
+
+    ///
+    ///  @fn        averageNsecs : const
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint64 QTerminalStats::Histogram::averageNsecs() const {
+        return (count > 0) ? totalNsecs / count : 0;
+    }
+
+
+    ///
+    ///  @fn        record
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalStats::record(Counters &counters, qint64 nsecs) {
+        // The bucket is the bit length of the duration in microseconds
+        quint64 usecs = static_cast<quint64>(qMax(nsecs, Q_INT64_C(0))) / 1000;
+        qint32 bucket = 64 - static_cast<qint32>(qCountLeadingZeroBits(usecs));
+        bucket = qMin(bucket, HistogramBuckets - 1);
+
+        counters.buckets[bucket].fetchAndAddRelaxed(1);
+        counters.count.fetchAndAddRelaxed(1);
+        counters.totalNsecs.fetchAndAddRelaxed(nsecs);
+
+        qint64 maximum = counters.maximumNsecs.load();
+        while (nsecs > maximum && !counters.maximumNsecs.testAndSetRelaxed(maximum, nsecs, maximum));
+    }
+
+    ///
+    ///  @fn        load
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalStats::Histogram QTerminalStats::load(const Counters &counters) {
+        Histogram histogram;
+        for (qint32 i = 0; i < HistogramBuckets; i++)
+            histogram.buckets[i] = counters.buckets[i].load();
+
+        histogram.count = counters.count.load();
+        histogram.totalNsecs = counters.totalNsecs.load();
+        histogram.maximumNsecs = counters.maximumNsecs.load();
+        return histogram;
+    }
+
+
+    ///
+    ///  @fn        addOutput
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalStats::addOutput(qint64 characters, qint64 lines) {
+        m_Characters.fetchAndAddRelaxed(characters);
+        m_Lines.fetchAndAddRelaxed(lines);
+    }
+
+    ///
+    ///  @fn        addPosted
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalStats::addPosted() {
+        m_Posted.fetchAndAddRelaxed(1);
+    }
+
+    ///
+    ///  @fn        addDrained
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalStats::addDrained(qint64 count) {
+        m_Drained.fetchAndAddRelaxed(count);
+    }
+
+    ///
+    ///  @fn        addFlushLatency
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalStats::addFlushLatency(qint64 nsecs) {
+        record(m_FlushLatency, nsecs);
+    }
+
+    ///
+    ///  @fn        addApplyTime
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalStats::addApplyTime(qint64 nsecs) {
+        record(m_ApplyTime, nsecs);
+    }
+
+    ///
+    ///  @fn        addPaintTime
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalStats::addPaintTime(qint64 nsecs) {
+        record(m_PaintTime, nsecs);
+    }
+
+    ///
+    ///  @fn        addReadTime
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalStats::addReadTime(qint64 nsecs) {
+        m_Reads.fetchAndAddRelaxed(1);
+        m_ReadNsecs.fetchAndAddRelaxed(nsecs);
+    }
+
+    ///
+    ///  @fn        snapshot
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalStats::Snapshot QTerminalStats::snapshot() {
+        Snapshot s;
+        s.charactersWritten = m_Characters.load();
+        s.linesWritten = m_Lines.load();
+        s.queuedRecords = qMax(m_Posted.load() - m_Drained.load(), Q_INT64_C(0));
+        s.pendingRuns = 0;
+        s.blockCount = 0;
+        s.heldBytes = 0;
+        s.reads = m_Reads.load();
+        s.readBlockedNsecs = m_ReadNsecs.load();
+        s.flushLatency = load(m_FlushLatency);
+        s.applyTime = load(m_ApplyTime);
+        s.paintTime = load(m_PaintTime);
+
+        // Refreshes the rates once a full second has passed
+        qint64 elapsed = m_RateClock.elapsed();
+        if (elapsed >= 1000) {
+            m_CharactersPerSecond = (s.charactersWritten - m_RateCharacters) * 1000.0 / elapsed;
+            m_LinesPerSecond = (s.linesWritten - m_RateLines) * 1000.0 / elapsed;
+            m_RateCharacters = s.charactersWritten;
+            m_RateLines = s.linesWritten;
+            m_RateClock.restart();
+        }
+
+        s.charactersPerSecond = m_CharactersPerSecond;
+        s.linesPerSecond = m_LinesPerSecond;
+        return s;
+    }
+}
@@ -0,0 +1,364 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+//
+//  Included headers
+//
+#include <KGL/Core/QTerminalTrace.hpp>
+#include <QAtomicInteger>
+#include <QCoreApplication>
+#include <QFile>
+#include <QMutex>
+#include <QThread>
+#include <QVector>
+#include <chrono>
+
+
+namespace kgl {
+
+    namespace {
+
+        //
+        // One finished span
+        //
+        struct Event {
+            const char *name;
+            qint64 start;
+            qint64 duration;
+            qint64 value;
+        };
+
+        //
+        // Spans of one thread. Only the owning thread writes 'events'
+        // and 'head'; readers copy and then discard what was overwritten
+        //
+        struct Ring {
+            Event events[QTerminalTrace::RingCapacity];
+            QAtomicInteger<quint64> head;
+            QAtomicInteger<quint64> first;
+            QByteArray thread;
+            qint32 id;
+            bool isFree;
+        };
+
+        //
+        // Spans a thread recorded before it exited
+        //
+        struct Archive {
+            QByteArray thread;
+            qint32 id;
+            QVector<Event> events;
+        };
+
+        //
+        // All rings, of running threads and free ones to be reused, and
+        // the spans of exited threads, RingCapacity of them at most
+        //
+        struct Registry {
+            QMutex mutex;
+            QVector<Ring *> rings;
+            QVector<Archive> archives;
+            qint32 archived;
+            qint32 nextId;
+
+            Registry() : archived(0), nextId(0) {}
+        };
+
+        //
+        // Hands the ring back once its thread exits
+        //
+        struct RingOwner {
+            Ring *ring;
+            ~RingOwner();
+        };
+
+        thread_local RingOwner t_Owner = { NULL };
+
+        ///
+        ///  @fn      registry
+        ///  @brief   Creates the registry on first use.
+        ///  @returns the process-wide registry.
+        ///
+        Registry &registry() {
+            static Registry r;
+            return r;
+        }
+
+        ///
+        ///  @fn      createRing
+        ///  @brief   Creates and registers the ring of the calling thread.
+        ///  @returns the new ring.
+        ///
+        Ring *createRing() {
+            Registry &r = registry();
+            QMutexLocker lock(&r.mutex);
+
+            // Reuses the ring of an exited thread before allocating one
+            Ring *ring = NULL;
+            for (Ring *free : qAsConst(r.rings)) {
+                if (free->isFree) {
+                    ring = free;
+                    break;
+                }
+            }
+            if (!ring) {
+                ring = new Ring;
+                r.rings.append(ring);
+            }
+
+            ring->head.store(0);
+            ring->first.store(0);
+            ring->id = ++r.nextId;
+            ring->isFree = false;
+
+            // Names the thread like it is named in the application
+            QThread *thread = QThread::currentThread();
+            if (!thread->objectName().isEmpty()) {
+                ring->thread = thread->objectName().toUtf8();
+            } else if (QCoreApplication::instance() && thread == QCoreApplication::instance()->thread()) {
+                ring->thread = "GUI";
+            } else {
+                ring->thread = "Thread " + QByteArray::number(ring->id);
+            }
+
+            return ring;
+        }
+
+        ///
+        ///  @fn    RingOwner::~RingOwner
+        ///  @brief Archives the spans of the exiting thread and frees
+        ///         its ring. Nothing writes the ring anymore.
+        ///
+        RingOwner::~RingOwner() {
+            if (!ring)
+                return;
+
+            Registry &r = registry();
+            QMutexLocker lock(&r.mutex);
+
+            const quint64 capacity = QTerminalTrace::RingCapacity;
+            quint64 head = ring->head.load();
+            quint64 first = qMax(ring->first.load(), (head > capacity) ? head - capacity : 0);
+
+            Archive archive = { ring->thread, ring->id, QVector<Event>() };
+            for (quint64 i = first; i < head; i++)
+                archive.events.append(ring->events[i % capacity]);
+
+            // Keeps the newest spans of exited threads within one ring's worth
+            if (!archive.events.isEmpty()) {
+                r.archived += archive.events.size();
+                r.archives.append(archive);
+            }
+            while (r.archived > QTerminalTrace::RingCapacity) {
+                Archive &oldest = r.archives.first();
+                qint32 drop = qMin(oldest.events.size(), r.archived - QTerminalTrace::RingCapacity);
+                oldest.events.remove(0, drop);
+                r.archived -= drop;
+                if (oldest.events.isEmpty())
+                    r.archives.removeFirst();
+            }
+
+            ring->isFree = true;
+            ring = NULL;
+        }
+
+        ///
+        ///  @fn    appendString
+        ///  @brief Appends a JSON string literal.
+        ///
+        void appendString(QByteArray &out, const char *s) {
+            out += '"';
+            for (; *s; s++) {
+                if (*s == '"' || *s == '\\')
+                    out += '\\';
+                if (static_cast<uchar>(*s) >= 0x20)
+                    out += *s;
+            }
+            out += '"';
+        }
+
+        ///
+        ///  @fn    appendMicroseconds
+        ///  @brief Appends nanoseconds as microseconds with three decimals.
+        ///
+        void appendMicroseconds(QByteArray &out, qint64 nsecs) {
+            char fraction[4] = { '0', '0', '0', 0 };
+            qint64 remainder = nsecs % 1000;
+            for (int i = 2; i >= 0; i--, remainder /= 10)
+                fraction[i] = static_cast<char>('0' + remainder % 10);
+
+            out += QByteArray::number(nsecs / 1000);
+            out += '.';
+            out += fraction;
+        }
+
+        ///
+        ///  @fn    appendThread
+        ///  @brief Appends the name and the spans of one thread.
+        ///
+        void appendThread(QByteArray &out, const QByteArray &pid, qint32 id, const QByteArray &thread,
+                          const Event *events, qint32 count) {
+            const QByteArray tid = QByteArray::number(id);
+
+            out += "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":" + pid + ",\"tid\":" + tid + ",\"args\":{\"name\":";
+            appendString(out, thread.constData());
+            out += "}}";
+
+            for (qint32 i = 0; i < count; i++) {
+                const Event &e = events[i];
+                out += ",{\"ph\":\"X\",\"cat\":\"QTerminal\",\"name\":";
+                appendString(out, e.name);
+                out += ",\"ts\":";
+                appendMicroseconds(out, e.start);
+                out += ",\"dur\":";
+                appendMicroseconds(out, e.duration);
+                out += ",\"pid\":" + pid + ",\"tid\":" + tid;
+                if (e.value >= 0)
+                    out += ",\"args\":{\"value\":" + QByteArray::number(e.value) + '}';
+                out += '}';
+            }
+        }
+    }
+
+
+    QAtomicInt QTerminalTrace::m_IsEnabled(0);
+
+
+    ///
+    ///  @fn        setEnabled
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalTrace::setEnabled(bool enabled) {
+        m_IsEnabled.storeRelease(enabled ? 1 : 0);
+    }
+
+    ///
+    ///  @fn        clear
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalTrace::clear() {
+        Registry &r = registry();
+        QMutexLocker lock(&r.mutex);
+        for (Ring *ring : qAsConst(r.rings))
+            ring->first.storeRelease(ring->head.loadAcquire());
+
+        r.archives.clear();
+        r.archived = 0;
+    }
+
+    ///
+    ///  @fn        now
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint64 QTerminalTrace::now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    ///
+    ///  @fn        record
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalTrace::record(const char *name, qint64 start, qint64 duration, qint64 value) {
+        Ring *ring = t_Owner.ring;
+        if (!ring)
+            ring = t_Owner.ring = createRing();
+
+        // Fills the slot before publishing it
+        quint64 head = ring->head.load();
+        Event &e = ring->events[head % RingCapacity];
+        e.name = name;
+        e.start = start;
+        e.duration = duration;
+        e.value = value;
+        ring->head.storeRelease(head + 1);
+    }
+
+    ///
+    ///  @fn        toJson
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QByteArray QTerminalTrace::toJson() {
+        const quint64 capacity = RingCapacity;
+        const QByteArray pid = QByteArray::number(QCoreApplication::applicationPid());
+        QVector<Event> events;
+        QByteArray out;
+        bool isFirst = true;
+
+        Registry &r = registry();
+        QMutexLocker lock(&r.mutex);
+
+        out += "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        for (const Ring *ring : qAsConst(r.rings)) {
+            if (ring->isFree)
+                continue;
+
+            // Copies the published spans, oldest first
+            quint64 head = ring->head.loadAcquire();
+            quint64 first = qMax(ring->first.loadAcquire(), (head > capacity) ? head - capacity : 0);
+            events.clear();
+            for (quint64 i = first; i < head; i++)
+                events.append(ring->events[i % capacity]);
+
+            // Drops what the owner overwrote meanwhile, including the
+            // slot it may be writing right now
+            quint64 after = ring->head.loadAcquire();
+            quint64 valid = (after + 1 > capacity) ? after + 1 - capacity : 0;
+            qint32 skip = (valid > first) ? static_cast<qint32>(qMin(valid - first, head - first)) : 0;
+
+            if (!isFirst)
+                out += ',';
+            isFirst = false;
+            appendThread(out, pid, ring->id, ring->thread, events.constData() + skip, events.size() - skip);
+        }
+
+        // Followed by the threads that exited meanwhile
+        for (const Archive &archive : qAsConst(r.archives)) {
+            if (!isFirst)
+                out += ',';
+            isFirst = false;
+            appendThread(out, pid, archive.id, archive.thread, archive.events.constData(), archive.events.size());
+        }
+
+        out += "]}\n";
+        return out;
+    }
+
+    ///
+    ///  @fn        save
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalTrace::save(const QString &path) {
+        QFile file(path);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+            return false;
+
+        QByteArray json = toJson();
+        return file.write(json) == json.size();
+    }
+}
@@ -0,0 +1,187 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+//
+//  Included headers
+//
+#include <KGL/Core/QUtf8Decoder.hpp>
+#include <cstring>
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define KGL_UTF8_SSE2
+#include <emmintrin.h>
+#endif
+
+
+namespace kgl {
+
+    ///
+    ///  @fn        Default constructor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QUtf8Decoder::QUtf8Decoder() {
+        reset();
+    }
+
+
+    ///
+    ///  @fn        hasPendingBytes
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QUtf8Decoder::hasPendingBytes() const {
+        return m_Remaining > 0;
+    }
+
+    ///
+    ///  @fn        reset
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QUtf8Decoder::reset() {
+        m_CodePoint = 0;
+        m_Minimum = 0;
+        m_Remaining = 0;
+    }
+
+    ///
+    ///  @fn        decode
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QUtf8Decoder::decode(const char *data, qint64 length, QString &out) {
+        const uchar *src = reinterpret_cast<const uchar *>(data);
+
+        // QString is limited to int; decodes huge inputs in slices
+        while (length > 0) {
+            qint32 slice = static_cast<qint32>(qMin(length, Q_INT64_C(1) << 26));
+            qint32 size = out.size();
+
+            // One byte never yields more than one UTF-16 unit, except
+            // when it completes a sequence started in a previous chunk
+            out.resize(size + slice + 2);
+            qint32 written = decodeChunk(src, slice, out.data() + size);
+            out.resize(size + written);
+
+            src += slice;
+            length -= slice;
+        }
+    }
+
+
+    ///
+    ///  @fn        decodeChunk
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint32 QUtf8Decoder::decodeChunk(const uchar *src, qint32 length, QChar *dst) {
+        const uchar *end = src + length;
+        QChar *begin = dst;
+
+        while (src != end) {
+            // Widens runs of ASCII without inspecting single bytes
+            if (m_Remaining == 0) {
+#ifdef KGL_UTF8_SSE2
+                const __m128i zero = _mm_setzero_si128();
+                while (end - src >= 16) {
+                    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+                    if (_mm_movemask_epi8(chunk) != 0) {
+                        break;
+                    }
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_unpacklo_epi8(chunk, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 8), _mm_unpackhi_epi8(chunk, zero));
+                    src += 16;
+                    dst += 16;
+                }
+#else
+                while (end - src >= 8) {
+                    quint64 word;
+                    std::memcpy(&word, src, sizeof(word));
+                    if ((word & Q_UINT64_C(0x8080808080808080)) != 0) {
+                        break;
+                    }
+
+                    for (int i = 0; i < 8; ++i) {
+                        dst[i] = QChar(static_cast<ushort>(src[i]));
+                    }
+                    src += 8;
+                    dst += 8;
+                }
+#endif
+                if (src == end) {
+                    break;
+                }
+            }
+
+            uchar b = *src++;
+
+            // Continues a multi-byte sequence
+            if (m_Remaining > 0) {
+                if ((b & 0xC0) == 0x80) {
+                    m_CodePoint = (m_CodePoint << 6) | (b & 0x3F);
+                    if (--m_Remaining > 0) {
+                        continue;
+                    }
+
+                    // Rejects overlong forms, surrogates and out of range
+                    quint32 cp = m_CodePoint;
+                    if (cp < m_Minimum || (cp >= 0xD800 && cp <= 0xDFFF) || cp > 0x10FFFF) {
+                        *dst++ = QChar(QChar::ReplacementCharacter);
+                    } else if (cp >= 0x10000) {
+                        *dst++ = QChar(static_cast<ushort>(0xD7C0 + (cp >> 10)));
+                        *dst++ = QChar(static_cast<ushort>(0xDC00 | (cp & 0x3FF)));
+                    } else {
+                        *dst++ = QChar(static_cast<ushort>(cp));
+                    }
+                    continue;
+                }
+
+                // Truncated sequence; the byte starts something new
+                *dst++ = QChar(QChar::ReplacementCharacter);
+                m_Remaining = 0;
+            }
+
+            // Starts a new sequence
+            if (b < 0x80) {
+                *dst++ = QChar(static_cast<ushort>(b));
+            } else if (b >= 0xC2 && b <= 0xDF) {
+                m_CodePoint = b & 0x1F;
+                m_Minimum = 0x80;
+                m_Remaining = 1;
+            } else if (b >= 0xE0 && b <= 0xEF) {
+                m_CodePoint = b & 0x0F;
+                m_Minimum = 0x800;
+                m_Remaining = 2;
+            } else if (b >= 0xF0 && b <= 0xF4) {
+                m_CodePoint = b & 0x07;
+                m_Minimum = 0x10000;
+                m_Remaining = 3;
+            } else {
+                *dst++ = QChar(QChar::ReplacementCharacter);
+            }
+        }
+
+        return static_cast<qint32>(dst - begin);
+    }
+}
@@ -25,9 +25,17 @@
 //
 #include <KGL/Dialogs/QTerminal.hpp>
 #include <KGL/Dialogs/QFormatEditor.hpp>
+#include <KGL/Core/QTerminalTrace.hpp>
+#include <QEventLoop>
+#include <QFontDatabase>
 #include <QFontDialog>
+#include <QFontMetrics>
 #include <QKeyEvent>
+#include <QAbstractTextDocumentLayout>
+#include <QScrollBar>
+#include <QTextBlock>
 #include <QBrush>
+#include <algorithm>
 #ifdef Q_OS_WIN
 #include <windows.h>
 #endif
@@ -35,6 +43,95 @@
 
 namespace kgl {
 
+    ///
+    ///  @struct    AnsiHandler
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    struct QTerminal::AnsiHandler : public QAnsiParser::Handler {
+        QTerminal *terminal;
+
+        void text(const QChar *data, qint32 length) {
+            terminal->pendingText().append(data, length);
+        }
+
+        void attributes(const QAnsiParser::Attributes &attributes) {
+            terminal->m_Style = terminal->styleIndex(attributes);
+        }
+    };
+
+    ///
+    ///  @struct    InputEdit
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    struct QTerminal::InputEdit : public QTextEdit {
+        QTerminalStats *stats;
+
+        explicit InputEdit(QTerminalStats *s)
+            : stats(s) {
+        }
+
+        void paintEvent(QPaintEvent *e) {
+            KGL_TRACE_SPAN("paint");
+            QElapsedTimer clock;
+            clock.start();
+            QTextEdit::paintEvent(e);
+            stats->addPaintTime(clock.nsecsElapsed());
+        }
+    };
+
+    //
+    //  Tuning constants of the output path
+    //
+    namespace {
+        /// Characters of the open line matched again with the next batch.
+        const qint32 HighlightContext = 4096;
+
+        /// Estimated memory of one document block beyond its text.
+        const qint32 DocumentBlockBytes = 256;
+    }
+
+    //
+    //  Append arrays of numbers separated by 'separator'
+    //
+    namespace {
+        template <typename T>
+        void appendNumbers(const T *values, qint32 count,
+                           const QNumberFormatter::Options &options,
+                           const QString &separator, QString &out) {
+            if (count <= 0)
+                return;
+
+            // Three characters per byte hold any decimal or hex number
+            qint32 estimate = qMax(options.width, 3 * int(sizeof(T)));
+            out.reserve(out.size() + count * (estimate + separator.size()));
+
+            QNumberFormatter::append(static_cast<quint64>(values[0]), options, out);
+            for (qint32 i = 1; i < count; ++i) {
+                out.append(separator);
+                QNumberFormatter::append(static_cast<quint64>(values[i]), options, out);
+            }
+        }
+
+        template <typename T>
+        void appendFloats(const T *values, qint32 count, FloatFormat f, int precision,
+                          const QString &separator, QString &out) {
+            if (count <= 0)
+                return;
+
+            // Shortest doubles rarely exceed 24 characters
+            out.reserve(out.size() + count * (24 + separator.size()));
+
+            QFloatFormatter::append(values[0], f, precision, out);
+            for (qint32 i = 1; i < count; ++i) {
+                out.append(separator);
+                QFloatFormatter::append(values[i], f, precision, out);
+            }
+        }
+    }
+
+
     ///
     ///  @fn        Constructor
     ///  @author    Nicolas Kogler
@@ -44,14 +141,44 @@ namespace kgl {
         : QDialog(parent),
           m_Layout(NULL),
           m_Input(NULL),
+          m_View(NULL),
+          m_FileView(NULL),
+          m_Log(NULL),
+          m_Recorder(NULL),
+          m_Replay(NULL),
+          m_ReplayTimer(NULL),
+          m_MappedFile(NULL),
+          m_IndexTimer(NULL),
+          m_Search(NULL),
+          m_SearchBar(NULL),
+          m_Process(NULL),
+          m_StatsOverlay(NULL),
+          m_StatsTimer(NULL),
+          m_StatsAction(NULL),
           m_Menu(NULL),
+          m_FlushTimer(NULL),
+          m_IsDrainQueued(0),
+          m_IsSearchQueued(0),
+          m_IsProcessQueued(0),
+          m_ReplaySpeed(1.0),
           m_Flag(TextState::Success),
+          m_Backend(RenderBackend::Document),
+          m_EvictedLines(0),
+          m_SearchLine(0),
           m_CaretPos(0),
           m_InitialPos(0),
-          m_IsReturnPressed(false),
-          m_IsReading(false) {
+          m_Style(0),
+          m_IsReading(false),
+          m_HasReplayEvent(false),
+          m_HasMatch(false),
+          m_IsProcessPaused(false),
+          m_IsForwardQueued(false) {
 
         QMenu *file = new QMenu, *format = new QMenu, *help = new QMenu;
+        file->addAction("Find ...", this, SLOT(showSearchBar()), QKeySequence::Find);
+        m_StatsAction = file->addAction("Statistics");
+        m_StatsAction->setCheckable(true);
+        connect(m_StatsAction, SIGNAL(toggled(bool)), this, SLOT(setStatsVisible(bool)));
         file->addAction("Close", this, SLOT(exitTerminal()), QKeySequence(Qt::Key_Alt, Qt::Key_F4));
         format->addAction("Palette ...", this, SLOT(showPaletteEditor()));
         format->addAction("Font ...", this, SLOT(showFontEditor()));
@@ -61,10 +188,12 @@ namespace kgl {
 
         // Creates the menu and the input box
         m_Menu = new QMenuBar;
-        m_Input = new QTextEdit;
+        m_Input = new InputEdit(&m_Stats);
         m_Input->setObjectName("input");
         m_Input->setFrameShape(QFrame::NoFrame);
+        m_Input->setUndoRedoEnabled(false);
         m_Input->installEventFilter(this);
+        m_Input->viewport()->installEventFilter(this);
         m_Menu->addMenu(file);
         m_Menu->addMenu(format);
         m_Menu->addMenu(help);
@@ -79,6 +208,13 @@ namespace kgl {
         m_Layout->setContentsMargins(0, 0, 0, 0);
         setLayout(m_Layout);
         updateDesign();
+        setCurrentState(TextState::Normal);
+
+        // Applies buffered output once per frame
+        m_FlushTimer = new QTimer(this);
+        m_FlushTimer->setSingleShot(true);
+        m_FlushTimer->setInterval(16);
+        connect(m_FlushTimer, SIGNAL(timeout()), this, SLOT(flush()));
 
         // Remove help button
         setWindowFlags(windowFlags() & ~Qt::WindowContextHelpButtonHint);
@@ -90,9 +226,27 @@ namespace kgl {
     ///  @date      October 20th, 2016
     ///
     QTerminal::~QTerminal() {
+        // The last frame of output still belongs in the log and recording
+        if (m_Log != NULL || m_Recorder != NULL) {
+            flush();
+        }
+
+        // Views owned by others must not paint the destroyed buffer
+        for (QTerminalView *view : bufferViews()) {
+            view->setSource(NULL);
+        }
+
+        delete m_Process;
+        delete m_Search;
         delete m_Layout;
         delete m_Menu;
         delete m_Input;
+        delete m_View;
+        delete m_FileView;
+        delete m_MappedFile;
+        delete m_Log;
+        delete m_Recorder;
+        delete m_Replay;
     }
 
 
@@ -150,6 +304,17 @@ namespace kgl {
             m_Input->setFontFamily(m_Design.font().family());
             m_Input->setFontPointSize(m_Design.font().pointSize());
             m_Input->setTextCursor(cursor);
+            updateFormats();
+
+            for (QTerminalView *view : bufferViews()) {
+                view->setDesign(m_Design);
+            }
+            if (m_FileView) {
+                m_FileView->setDesign(m_Design);
+            }
+
+            // The cell size changed; tell the pty its new extent
+            updateWindowSize();
         }
     }
 
@@ -159,23 +324,114 @@ namespace kgl {
     ///  @date      October 21th, 2016
     ///
     QString QTerminal::readPrivate() {
-        QTextCursor cursor = m_Input->textCursor();
-        m_InitialPos = m_CaretPos = cursor.position();
+        KGL_TRACE_SPAN("read");
+        QString line;
+        QEventLoop loop;
+        bool isDone = false;
+
+        // Sleeps in a nested event loop until return is pressed
+        enqueueRead([&](const QString &s) {
+            line = s;
+            isDone = true;
+            loop.quit();
+        });
+
+        // Counts the time the caller was blocked waiting for input
+        QElapsedTimer clock;
+        clock.start();
+        if (!isDone) {
+            loop.exec();
+        }
+
+        m_Stats.addReadTime(clock.nsecsElapsed());
+        return line;
+    }
+
+    ///
+    ///  @fn        enqueueRead
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::enqueueRead(const std::function<void(const QString &)> &callback) {
+        m_Reads.enqueue(callback);
+        if (m_Reads.size() == 1) {
+            beginRead();
+        }
+    }
+
+    ///
+    ///  @fn        beginRead
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::beginRead() {
+        flush();
         m_IsReading = true;
 
-        // Waits until return is pressed
-        while (!m_IsReturnPressed) {
-            QCoreApplication::processEvents();
+        // The grid views edit the input line of the buffer
+        if (m_Backend == RenderBackend::Grid) {
+            m_Buffer.beginInput(m_Style);
+            for (QTerminalView *view : bufferViews()) {
+                view->updateContents();
+                view->scrollToBottom();
+            }
+            return;
+        }
+
+        // The input region starts at the end of the document
+        QTextCursor tc = m_Input->textCursor();
+        tc.movePosition(QTextCursor::End);
+        m_Input->setTextCursor(tc);
+        m_Input->setCurrentCharFormat(m_Formats.at(m_Style));
+        m_InitialPos = m_CaretPos = tc.position();
+    }
+
+    ///
+    ///  @fn        completeRead
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::completeRead() {
+        // Output that is still pending goes in front of the line
+        QString line;
+        flush();
+        if (m_Backend == RenderBackend::Grid) {
+            line = m_Buffer.commitInput();
+            updateViews();
+        } else {
+            // Get string that was typed in that time
+            QTextCursor tc(m_Input->document());
+            tc.setPosition(m_InitialPos);
+            tc.movePosition(QTextCursor::End, QTextCursor::KeepAnchor);
+            line = tc.selectedText();
+
+            // Terminates the input line
+            tc.clearSelection();
+            tc.insertText("\n");
+            m_Input->setTextCursor(tc);
+
+            // The document only shows the buffer, which takes the line too
+            m_Buffer.append(line + QLatin1Char('\n'), m_Style);
+            updateViews();
         }
 
         m_IsReading = false;
-        m_IsReturnPressed = false;
+        if (m_Log != NULL) {
+            m_Log->append(line + QLatin1Char('\n'), attributesOf(m_Style));
+        }
+        if (m_Recorder != NULL) {
+            QAnsiParser::Attributes attributes = attributesOf(m_Style);
+            m_Recorder->recordInput(line, attributes.state, attributes.inverse);
+            m_Recorder->flush();
+        }
 
-        // Get string that was typed in that time
-        QTextCursor tc = m_Input->textCursor();
-        tc.setPosition(tc.position()-1);
-        tc.setPosition(m_InitialPos, QTextCursor::KeepAnchor);
-        return tc.selectedText();
+        // Starts the next queued read before handing out the line
+        std::function<void(const QString &)> callback = m_Reads.dequeue();
+        if (!m_Reads.isEmpty()) {
+            beginRead();
+        }
+
+        callback(line);
     }
 
     ///
@@ -184,6 +440,14 @@ namespace kgl {
     ///  @date      October 21th, 2016
     ///
     bool QTerminal::eventFilter(QObject *o, QEvent *e) {
+        // Keeps the window size of a pty child in step with the output
+        if (e->type() == QEvent::Resize) {
+            QWidget *output = (m_Backend == RenderBackend::Grid) ? m_View->viewport() : m_Input->viewport();
+            if (o == output) {
+                updateWindowSize();
+            }
+        }
+
         if (o->objectName() == "input" && m_IsReading) {
             if (e->type() != QEvent::KeyPress)
                 return QDialog::eventFilter(o, e);
@@ -205,7 +469,8 @@ namespace kgl {
 
             // If enter was pressed, returns from the reading process
             if (ke->key() == Qt::Key_Return) {
-                m_IsReturnPressed = true;
+                completeRead();
+                return true;
             }
 
             bool result = QDialog::eventFilter(o, e);
@@ -223,6 +488,7 @@ namespace kgl {
     ///  @date      October 20th, 2016
     ///
     void QTerminal::updateDesign() {
+        KGL_TRACE_SPAN("updateDesign");
         QPalette pal = m_Input->palette();
         pal.setColor(QPalette::Base, m_Design.backColor());
         pal.setColor(QPalette::Text, m_Design.textColor());
@@ -232,6 +498,16 @@ namespace kgl {
         m_Input->setPalette(pal);
         m_Input->setFont(m_Design.font());
         m_Menu->setStyleSheet(menuStyleSheet());
+        updateFormats();
+
+        for (QTerminalView *view : bufferViews()) {
+            view->setDesign(m_Design);
+        }
+        if (m_FileView) {
+            m_FileView->setDesign(m_Design);
+        }
+
+        updateWindowSize();
     }
 
 
@@ -250,6 +526,142 @@ namespace kgl {
     ///  @date      October 20th, 2016
     ///
     void QTerminal::setCurrentState(TextState state, bool highlight) {
+        m_Style = styleIndex(state, highlight);
+    }
+
+    ///
+    ///  @fn        setNumberPadding
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::setNumberPadding(int width, QChar fill) {
+        m_Number.width = qMax(width, 0);
+        m_Number.fill = fill;
+    }
+
+    ///
+    ///  @fn        setDigitGrouping
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::setDigitGrouping(QChar separator) {
+        m_Number.separator = separator;
+    }
+
+    ///
+    ///  @fn        styleIndex
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    quint16 QTerminal::styleIndex(TextState state, bool highlight) {
+        return QTerminalBuffer::styleOf(state, highlight);
+    }
+
+    ///
+    ///  @fn        styleIndex
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    quint16 QTerminal::styleIndex(const QAnsiParser::Attributes &attributes) {
+        const QAnsiParser::Attributes &a = attributes;
+        if (a.foreground == 0 && a.background == 0 && !a.bold && !a.underline) {
+            return styleIndex(a.state, a.inverse);
+        }
+
+        // Packs all attributes into one key
+        quint64 key = static_cast<quint64>(a.foreground & 0xFFFFFF)
+                | (static_cast<quint64>(a.foreground != 0) << 24)
+                | (static_cast<quint64>(a.background & 0xFFFFFF) << 25)
+                | (static_cast<quint64>(a.background != 0) << 49)
+                | (static_cast<quint64>(a.state) << 50)
+                | (static_cast<quint64>(a.bold) << 52)
+                | (static_cast<quint64>(a.underline) << 53)
+                | (static_cast<quint64>(a.inverse) << 54);
+
+        QHash<quint64, quint16>::const_iterator it = m_CustomStyleIndices.constFind(key);
+        if (it != m_CustomStyleIndices.constEnd()) {
+            return it.value();
+        }
+
+        // Falls back to the plain state if too many colors were used
+        if (m_Formats.size() >= 4096) {
+            return styleIndex(a.state, a.inverse);
+        }
+
+        quint16 style = static_cast<quint16>(m_Formats.size());
+        m_CustomStyles.append(a);
+        m_CustomStyleIndices.insert(key, style);
+        m_Formats.append(createFormat(a));
+
+        for (QTerminalView *view : bufferViews()) {
+            view->setFormats(m_Formats);
+        }
+        if (m_FileView) {
+            m_FileView->setFormats(m_Formats);
+        }
+
+        return style;
+    }
+
+    ///
+    ///  @fn        createFormat
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTextCharFormat QTerminal::createFormat(const QAnsiParser::Attributes &attributes) const {
+        QTextCharFormat format = createFormat(attributes.state, attributes.inverse);
+        if (attributes.foreground != 0) {
+            format.setForeground(QBrush(QColor::fromRgba(attributes.foreground)));
+        }
+        if (attributes.background != 0) {
+            format.setBackground(QBrush(QColor::fromRgba(attributes.background)));
+        }
+        if (attributes.bold) {
+            format.setFontWeight(QFont::Bold);
+        }
+        if (attributes.underline) {
+            format.setFontUnderline(true);
+        }
+
+        return format;
+    }
+
+    ///
+    ///  @fn        updateFormats
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::updateFormats() {
+        static const TextState states[] = {
+            TextState::Normal, TextState::Error, TextState::Success, TextState::Warning
+        };
+
+        // Builds one format per state and highlight combination
+        m_Formats.resize(8 + m_CustomStyles.size());
+        for (TextState state : states) {
+            m_Formats[styleIndex(state, false)] = createFormat(state, false);
+            m_Formats[styleIndex(state, true)] = createFormat(state, true);
+        }
+
+        // Followed by the formats that were requested by ANSI sequences
+        for (int i = 0; i < m_CustomStyles.size(); ++i) {
+            m_Formats[8 + i] = createFormat(m_CustomStyles.at(i));
+        }
+
+        for (QTerminalView *view : bufferViews()) {
+            view->setFormats(m_Formats);
+        }
+        if (m_FileView) {
+            m_FileView->setFormats(m_Formats);
+        }
+    }
+
+    ///
+    ///  @fn        createFormat
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTextCharFormat QTerminal::createFormat(TextState state, bool highlight) const {
         QTextCharFormat format;
         format.setFont(m_Design.font());
 
@@ -264,7 +676,7 @@ namespace kgl {
         case TextState::Warning: format.setForeground(QBrush(m_Design.warningColor())); break;
         }
 
-        m_Input->setCurrentCharFormat(format);
+        return format;
     }
 
     ///
@@ -282,238 +694,1894 @@ namespace kgl {
     ///  @date      October 21th, 2016
     ///
     void QTerminal::clear() {
+        m_Pending.clear();
+        m_FlushTimer->stop();
         m_Input->clear();
+        m_Buffer.clear();
+        m_Ansi.reset();
+        m_Utf8.reset();
+        m_InitialPos = m_CaretPos = 0;
+
+        // Both are empty, so the document continues the buffer's numbering
+        m_EvictedLines = m_Buffer.evictedLines();
+
+        // Matches refer to lines that no longer exist
+        if (m_Search) {
+            m_Search->clear();
+            m_SearchLine = 0;
+            m_HasMatch = false;
+            updateSearchHighlights();
+        }
+
+        updateViews();
     }
 
     ///
-    ///  @fn        readChar
+    ///  @fn        flushInterval
     ///  @author    Nicolas Kogler
-    ///  @date      October 21th, 2016
+    ///  @date      October 18th, 2026
     ///
-    QChar QTerminal::readChar() {
-        QString s = readPrivate();
-
-        // Returns only the first character
-        return s[0];
+    int QTerminal::flushInterval() const {
+        return m_FlushTimer->interval();
     }
 
     ///
-    ///  @fn        readLine
+    ///  @fn        setFlushInterval
     ///  @author    Nicolas Kogler
-    ///  @date      October 21th, 2016
+    ///  @date      October 18th, 2026
     ///
-    QString QTerminal::readLine() {
-        QString s = readPrivate();
-
-        // Returns the entire line
-        return s;
+    void QTerminal::setFlushInterval(int msec) {
+        m_FlushTimer->setInterval(qMax(0, msec));
     }
 
     ///
-    ///  @fn        readString
+    ///  @fn        renderBackend
     ///  @author    Nicolas Kogler
-    ///  @date      October 21th, 2016
+    ///  @date      October 18th, 2026
     ///
-    QString QTerminal::readString(quint32 size) {
-        QString s = readPrivate();
-
-        // Trims the string by size
-        return s.left(size);
+    RenderBackend QTerminal::renderBackend() const {
+        return m_Backend;
     }
 
     ///
-    ///  @fn        readByte
+    ///  @fn        setRenderBackend
     ///  @author    Nicolas Kogler
-    ///  @date      October 21th, 2016
+    ///  @date      October 18th, 2026
     ///
-    quint8 QTerminal::readByte() {
-        QString s = readPrivate();
-        m_Flag = TextState::Success;
-
-        // Attempts to parse the string
-        bool result;
-        uint b = s.toUInt(&result);
-        if (!result) {
-            setCurrentState(TextState::Error);
-            writeLine("Entered text is not a number.");
-            setCurrentState(TextState::Normal);
-            m_Flag = TextState::Error;
-            return b;
+    void QTerminal::setRenderBackend(RenderBackend backend) {
+        if (backend == m_Backend) {
+            return;
         }
 
-        // Checks whether number is in byte range
-        if (b > 0xFF) {
-            setCurrentState(TextState::Warning);
-            writeLine("Entered number exceeds byte range.");
-            setCurrentState(TextState::Normal);
-            m_Flag = TextState::Warning;
+        // Creates the grid view on first use
+        if (!m_View) {
+            m_View = new QTerminalView;
+            m_View->setDesign(m_Design);
+            m_View->setFormats(m_Formats);
+            m_View->setBuffer(&m_Buffer);
+            m_View->setStats(&m_Stats);
+            m_View->setVisible(false);
+            m_View->viewport()->installEventFilter(this);
+            m_Layout->addWidget(m_View);
+            connect(m_View, SIGNAL(returnPressed()), this, SLOT(completeRead()));
+            connect(m_View, SIGNAL(inputEdited()), this, SLOT(updateViews()));
         }
 
-        return static_cast<quint8>(b & 0xFF);
-    }
+        // The buffer takes all output before the backends swap
+        flush();
+
+        // Keeps what was typed so far across the switch
+        QString input;
+        if (m_IsReading) {
+            if (m_Backend == RenderBackend::Grid) {
+                input = m_Buffer.input();
+                m_Buffer.endInput();
+            } else {
+                QTextCursor tc(m_Input->document());
+                tc.setPosition(m_InitialPos);
+                tc.movePosition(QTextCursor::End, QTextCursor::KeepAnchor);
+                input = tc.selectedText();
+            }
+        }
 
-    ///
-    ///  @fn        readUInt16
-    ///  @author    Nicolas Kogler
-    ///  @date      October 21th, 2016
-    ///
-    quint16 QTerminal::readUInt16() {
-        QString s = readPrivate();
-        m_Flag = TextState::Success;
+        // Grid views paint the buffer as is; the document is built anew
+        m_Backend = backend;
+        if (m_Backend == RenderBackend::Document) {
+            rebuildDocument();
+        } else {
+            m_Input->clear();
+            m_InitialPos = m_CaretPos = 0;
+        }
 
-        // Attempts to parse the string
-        bool result;
-        uint b = s.toUInt(&result);
-        if (!result) {
-            setCurrentState(TextState::Error);
-            writeLine("Entered text is not a number.");
-            setCurrentState(TextState::Normal);
-            m_Flag = TextState::Error;
-            return b;
+        if (m_SearchBar && m_SearchBar->isVisible()) {
+            m_View->setSearch(m_Search);
+            updateSearchHighlights();
+        }
+        if (!m_MappedFile) {
+            showOutput();
         }
 
-        // Checks whether number is in short range
-        if (b > 0xFFFF) {
-            setCurrentState(TextState::Warning);
-            writeLine("Entered number exceeds short range.");
-            setCurrentState(TextState::Normal);
-            m_Flag = TextState::Warning;
+        // Restarts a pending read in the new backend
+        if (m_IsReading) {
+            beginRead();
+            if (m_Backend == RenderBackend::Grid) {
+                m_Buffer.insertInput(input);
+                updateViews();
+            } else {
+                QTextCursor tc = m_Input->textCursor();
+                tc.insertText(input, m_Formats.at(m_Style));
+                m_Input->setTextCursor(tc);
+                m_CaretPos = tc.position();
+            }
+        } else {
+            updateViews();
         }
 
-        return static_cast<quint16>(b & 0xFFFF);
+        updateWindowSize();
     }
 
     ///
-    ///  @fn        readUInt32
+    ///  @fn        scrollbackLines
     ///  @author    Nicolas Kogler
-    ///  @date      October 21th, 2016
+    ///  @date      October 18th, 2026
     ///
-    quint32 QTerminal::readUInt32() {
-        QString s = readPrivate();
-        m_Flag = TextState::Success;
-
-        // Attempts to parse the string
-        bool result;
-        quint64 b = s.toULongLong(&result);
-        if (!result) {
-            setCurrentState(TextState::Error);
-            writeLine("Entered text is not a number.");
-            setCurrentState(TextState::Normal);
-            m_Flag = TextState::Error;
-            return b;
-        }
-
-        // Checks whether number is in short range
-        if (b > 0xFFFFFFFF) {
-            setCurrentState(TextState::Warning);
-            writeLine("Entered number exceeds integer range.");
-            setCurrentState(TextState::Normal);
-            m_Flag = TextState::Warning;
-        }
-
-        return static_cast<quint32>(b & 0xFFFFFFFF);
+    int QTerminal::scrollbackLines() const {
+        return m_Buffer.maximumLines();
     }
 
     ///
-    ///  @fn        readUInt64
+    ///  @fn        scrollbackBytes
     ///  @author    Nicolas Kogler
-    ///  @date      October 21th, 2016
+    ///  @date      October 18th, 2026
     ///
-    quint64 QTerminal::readUInt64() {
-        QString s = readPrivate();
-        m_Flag = TextState::Success;
-
-        // Attempts to parse the string
-        bool result;
-        quint64 b = s.toULongLong(&result);
-        if (!result) {
-            setCurrentState(TextState::Error);
-            writeLine("Entered text is not a number.");
-            setCurrentState(TextState::Normal);
-            m_Flag = TextState::Error;
-        }
-
-        return b;
+    qint64 QTerminal::scrollbackBytes() const {
+        return m_Buffer.maximumBytes();
     }
 
     ///
-    ///  @fn        readFloat
+    ///  @fn        setScrollbackLines
     ///  @author    Nicolas Kogler
-    ///  @date      October 21th, 2016
+    ///  @date      October 18th, 2026
     ///
-    float QTerminal::readFloat() {
-        QString s = readPrivate();
-        m_Flag = TextState::Success;
-
-        // Attempts to parse the string
-        bool result;
-        float f = s.toFloat(&result);
-        if (!result) {
-            setCurrentState(TextState::Error);
-            writeLine("Entered text is not a floating-point number.");
-            setCurrentState(TextState::Normal);
-            m_Flag = TextState::Error;
-        }
-
-        return f;
+    void QTerminal::setScrollbackLines(int lines) {
+        m_Buffer.setMaximumLines(lines);
+        trimDocument();
+        updateViews();
     }
 
     ///
-    ///  @fn        readDouble
+    ///  @fn        setScrollbackBytes
     ///  @author    Nicolas Kogler
-    ///  @date      October 21th, 2016
+    ///  @date      October 18th, 2026
     ///
-    double QTerminal::readDouble() {
-        QString s = readPrivate();
-        m_Flag = TextState::Success;
-
-        // Attempts to parse the string
-        bool result;
-        double f = s.toDouble(&result);
-        if (!result) {
-            setCurrentState(TextState::Error);
-            writeLine("Entered text is not a floating-point number.");
-            setCurrentState(TextState::Normal);
-            m_Flag = TextState::Error;
-        }
-
-        return f;
+    void QTerminal::setScrollbackBytes(qint64 bytes) {
+        m_Buffer.setMaximumBytes(bytes);
+        trimDocument();
+        updateViews();
     }
 
     ///
-    ///  @fn        readHex
+    ///  @fn        heldBytes
     ///  @author    Nicolas Kogler
-    ///  @date      October 21th, 2016
+    ///  @date      October 18th, 2026
     ///
-    quint64 QTerminal::readHex() {
-        QString s = readPrivate();
-        m_Flag = TextState::Success;
-        s.remove("$").remove("&h", Qt::CaseInsensitive).remove("0x");
+    qint64 QTerminal::heldBytes() const {
+        qint64 bytes = m_Buffer.heldBytes();
 
-        // Attempts to parse the string
-        bool result;
-        quint64 h = s.toULongLong(&result, 16);
-        if (!result) {
-            setCurrentState(TextState::Error);
-            writeLine("Entered text is not a hex number.");
-            setCurrentState(TextState::Normal);
-            m_Flag = TextState::Error;
+        // The document holds every line a second time; besides the text,
+        // each block carries a fragment, its layout and its line data
+        if (m_Backend == RenderBackend::Document) {
+            const QTextDocument *doc = m_Input->document();
+            bytes += doc->characterCount() * static_cast<qint64>(sizeof(QChar));
+            bytes += doc->blockCount() * static_cast<qint64>(DocumentBlockBytes);
         }
 
-        return h;
+        return bytes;
     }
 
+    ///
+    ///  @fn        evictedLines
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint64 QTerminal::evictedLines() const {
+        return m_Buffer.evictedLines();
+    }
 
     ///
-    ///  @fn        writeChar
+    ///  @fn        buffer
     ///  @author    Nicolas Kogler
-    ///  @date      October 21th, 2016
+    ///  @date      October 18th, 2026
+    ///
+    const QTerminalBuffer &QTerminal::buffer() const {
+        return m_Buffer;
+    }
+
+    ///
+    ///  @fn        createView
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalView *QTerminal::createView(QWidget *parent) {
+        QTerminalView *view = new QTerminalView(parent);
+        view->setDesign(m_Design);
+        view->setFormats(m_Formats);
+        view->setBuffer(&m_Buffer);
+        view->setStats(&m_Stats);
+        connect(view, SIGNAL(returnPressed()), this, SLOT(completeRead()));
+        connect(view, SIGNAL(inputEdited()), this, SLOT(updateViews()));
+
+        m_Views.append(view);
+        return view;
+    }
+
+    ///
+    ///  @fn        outputLines : const
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint64 QTerminal::outputLines() const {
+        return m_Buffer.lineCount() + m_Buffer.evictedLines();
+    }
+
+    ///
+    ///  @fn        stats
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalStats::Snapshot QTerminal::stats() {
+        QTerminalStats::Snapshot s = m_Stats.snapshot();
+        s.pendingRuns = m_Pending.size();
+        s.heldBytes = heldBytes();
+        s.blockCount = m_Buffer.lineCount();
+
+        return s;
+    }
+
+    ///
+    ///  @fn        isStatsVisible : const
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminal::isStatsVisible() const {
+        return m_StatsOverlay && m_StatsOverlay->isVisible();
+    }
+
+    ///
+    ///  @fn        setStatsVisible
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::setStatsVisible(bool visible) {
+        // Creates the overlay on first use
+        if (visible && !m_StatsOverlay) {
+            m_StatsOverlay = new QLabel(this);
+            m_StatsOverlay->setAttribute(Qt::WA_TransparentForMouseEvents);
+            m_StatsOverlay->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+            m_StatsOverlay->setStyleSheet(
+                    "QLabel {"
+                    "   background-color: rgba(0, 0, 0, 160);"
+                    "   color: white;"
+                    "   padding: 6px;"
+                    "}");
+
+            m_StatsTimer = new QTimer(this);
+            m_StatsTimer->setInterval(1000);
+            connect(m_StatsTimer, SIGNAL(timeout()), this, SLOT(updateStatsOverlay()));
+        }
+        if (!m_StatsOverlay) {
+            return;
+        }
+
+        m_StatsOverlay->setVisible(visible);
+        m_StatsAction->setChecked(visible);
+        if (visible) {
+            updateStatsOverlay();
+            m_StatsTimer->start();
+        } else {
+            m_StatsTimer->stop();
+        }
+    }
+
+    ///
+    ///  @fn        updateStatsOverlay
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::updateStatsOverlay() {
+        QTerminalStats::Snapshot s = stats();
+        const QTerminalStats::Histogram *histograms[] = { &s.flushLatency, &s.applyTime, &s.paintTime };
+        const char *names[] = { "flush", "apply", "paint" };
+
+        QString text;
+        text += QString("output  %1 chars/s  %2 lines/s\n")
+                .arg(s.charactersPerSecond, 0, 'f', 0)
+                .arg(s.linesPerSecond, 0, 'f', 0);
+        text += QString("queue   %1 posted  %2 runs\n")
+                .arg(s.queuedRecords)
+                .arg(s.pendingRuns);
+        for (int i = 0; i < 3; i++) {
+            text += QString("%1   p50 %2 us  p99 %3 us  max %4 us  (%5)\n")
+                    .arg(names[i])
+                    .arg(histograms[i]->percentile(0.5))
+                    .arg(histograms[i]->percentile(0.99))
+                    .arg(histograms[i]->maximumNsecs / 1000)
+                    .arg(histograms[i]->count);
+        }
+        text += QString("lines   %1  ~%2 KiB\n")
+                .arg(s.blockCount)
+                .arg(s.heldBytes / 1024);
+        text += QString("read    %1 ms blocked  (%2)")
+                .arg(s.readBlockedNsecs / 1000000)
+                .arg(s.reads);
+
+        // Sticks to the top right corner below the menu
+        m_StatsOverlay->setText(text);
+        m_StatsOverlay->adjustSize();
+        m_StatsOverlay->move(width() - m_StatsOverlay->width() - 8, m_Menu->height() + 8);
+        m_StatsOverlay->raise();
+    }
+
+    ///
+    ///  @fn        openLog
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::openLog(const QString &path, LogEncoding encoding, qint64 maximumSize, int maximumFiles) {
+        if (m_Log == NULL) {
+            m_Log = new QTerminalLog;
+        }
+
+        // Output still pending belongs to the time before the log
+        flush();
+        m_Log->setRotation(maximumSize, maximumFiles);
+        m_Log->open(path, encoding);
+    }
+
+    ///
+    ///  @fn        closeLog
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::closeLog() {
+        if (m_Log != NULL) {
+            flush();
+            m_Log->close();
+        }
+    }
+
+    ///
+    ///  @fn        log
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalLog *QTerminal::log() const {
+        return m_Log;
+    }
+
+    ///
+    ///  @fn        startRecording
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminal::startRecording(const QString &path) {
+        stopRecording();
+
+        // Output still pending belongs to the time before the recording
+        flush();
+        m_Recorder = new QTerminalRecorder;
+        if (!m_Recorder->open(path)) {
+            delete m_Recorder;
+            m_Recorder = NULL;
+            return false;
+        }
+
+        return true;
+    }
+
+    ///
+    ///  @fn        stopRecording
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::stopRecording() {
+        if (m_Recorder != NULL) {
+            flush();
+            delete m_Recorder;
+            m_Recorder = NULL;
+        }
+    }
+
+    ///
+    ///  @fn        replay
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminal::replay(const QString &path, double speed) {
+        stopReplay();
+
+        m_Replay = new QTerminalReplay;
+        if (!m_Replay->open(path)) {
+            delete m_Replay;
+            m_Replay = NULL;
+            return false;
+        }
+
+        if (m_ReplayTimer == NULL) {
+            m_ReplayTimer = new QTimer(this);
+            m_ReplayTimer->setSingleShot(true);
+            connect(m_ReplayTimer, SIGNAL(timeout()), this, SLOT(replayNext()));
+        }
+
+        m_ReplaySpeed = speed;
+        m_HasReplayEvent = false;
+        m_ReplayClock.start();
+        m_ReplayTimer->start(0);
+        return true;
+    }
+
+    ///
+    ///  @fn        stopReplay
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::stopReplay() {
+        if (m_ReplayTimer != NULL) {
+            m_ReplayTimer->stop();
+        }
+
+        delete m_Replay;
+        m_Replay = NULL;
+        m_HasReplayEvent = false;
+    }
+
+    ///
+    ///  @fn        isReplaying
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminal::isReplaying() const {
+        return m_Replay != NULL;
+    }
+
+    ///
+    ///  @fn        replayNext
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::replayNext() {
+        if (m_Replay == NULL) {
+            return;
+        }
+
+        // Without a time factor, every slice writes for about half a frame
+        // before yielding to the event loop, so that painting keeps up
+        QElapsedTimer slice;
+        slice.start();
+
+        quint16 previous = m_Style;
+        for (;;) {
+            if (!m_HasReplayEvent) {
+                if (!m_Replay->next(m_ReplayEvent)) {
+                    m_Style = previous;
+                    stopReplay();
+                    emit replayFinished();
+                    return;
+                }
+
+                m_HasReplayEvent = true;
+            }
+
+            if (m_ReplaySpeed > 0) {
+                // Waits until the event is due in the scaled time line
+                qint64 now = qint64(m_ReplayClock.nsecsElapsed() / 1000 * m_ReplaySpeed);
+                if (m_ReplayEvent.time > now) {
+                    qint64 wait = qint64((m_ReplayEvent.time - now) / m_ReplaySpeed / 1000);
+                    m_ReplayTimer->start(int(qMin<qint64>(wait, 1000)));
+                    break;
+                }
+            } else if (slice.elapsed() >= 8) {
+                m_ReplayTimer->start(0);
+                break;
+            }
+
+            m_Style = styleIndex(m_ReplayEvent.state, m_ReplayEvent.highlight);
+            pendingText() += m_ReplayEvent.text;
+            if (m_ReplayEvent.isInput) {
+                pendingText() += QLatin1Char('\n');
+            }
+
+            m_HasReplayEvent = false;
+        }
+
+        // Restores the format of the other 'write' operations
+        m_Style = previous;
+    }
+
+    ///
+    ///  @fn        viewFile
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminal::viewFile(const QString &path) {
+        QTerminalMappedFile *file = new QTerminalMappedFile;
+        file->setStyleResolver([this](const QAnsiParser::Attributes &a) { return styleIndex(a); });
+        if (!file->open(path)) {
+            delete file;
+            return false;
+        }
+
+        closeFile();
+        m_MappedFile = file;
+
+        // Creates the file view on first use
+        if (!m_FileView) {
+            m_FileView = new QTerminalView;
+            m_FileView->setDesign(m_Design);
+            m_FileView->setFormats(m_Formats);
+            m_FileView->setFollowOutput(false);
+            m_FileView->setStats(&m_Stats);
+            m_FileView->setVisible(false);
+            m_Layout->addWidget(m_FileView);
+
+            m_IndexTimer = new QTimer(this);
+            m_IndexTimer->setInterval(100);
+            connect(m_IndexTimer, SIGNAL(timeout()), this, SLOT(updateFileView()));
+        }
+
+        m_FileView->setSource(m_MappedFile);
+        m_Input->setVisible(false);
+        if (m_View) {
+            m_View->setVisible(false);
+        }
+
+        m_FileView->setVisible(true);
+        m_FileView->setFocus();
+        m_IndexTimer->start();
+        return true;
+    }
+
+    ///
+    ///  @fn        closeFile
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::closeFile() {
+        if (!m_MappedFile) {
+            return;
+        }
+
+        m_IndexTimer->stop();
+        m_FileView->setSource(NULL);
+        m_FileView->setVisible(false);
+        delete m_MappedFile;
+        m_MappedFile = NULL;
+        showOutput();
+    }
+
+    ///
+    ///  @fn        isViewingFile
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminal::isViewingFile() const {
+        return m_MappedFile != NULL;
+    }
+
+    ///
+    ///  @fn        updateFileView
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::updateFileView() {
+        if (!m_MappedFile) {
+            return;
+        }
+
+        // Shows the lines found since the last tick
+        if (m_MappedFile->isIndexed()) {
+            m_IndexTimer->stop();
+        }
+
+        m_FileView->updateContents();
+    }
+
+    ///
+    ///  @fn        showOutput
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::showOutput() {
+        m_Input->setVisible(m_Backend == RenderBackend::Document);
+        if (m_View) {
+            m_View->setVisible(m_Backend == RenderBackend::Grid);
+        }
+
+        if (m_Backend == RenderBackend::Grid) {
+            m_View->setFocus();
+        } else {
+            m_Input->setFocus();
+        }
+    }
+
+    ///
+    ///  @fn        attachProcess
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminal::attachProcess(const QString &program, const QStringList &arguments, bool usePty) {
+        if (m_Process) {
+            return false;
+        }
+
+        m_Process = new QTerminalProcess;
+        m_Process->setNotifier([this]() {
+            if (m_IsProcessQueued.testAndSetOrdered(0, 1)) {
+                QMetaObject::invokeMethod(this, "readProcess", Qt::QueuedConnection);
+            }
+        });
+
+        if (!m_Process->start(program, arguments, usePty)) {
+            setCurrentState(TextState::Error);
+            writeLine(m_Process->errorString());
+            setCurrentState(TextState::Normal);
+            delete m_Process;
+            m_Process = NULL;
+            return false;
+        }
+
+        updateWindowSize();
+        m_ProcessOutput.reset();
+        m_ProcessError.reset();
+        m_IsProcessPaused = false;
+        if (!m_IsForwardQueued) {
+            forwardInput();
+        }
+
+        return true;
+    }
+
+    ///
+    ///  @fn        detachProcess
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::detachProcess() {
+        if (!m_Process) {
+            return;
+        }
+
+        // Kills the child and waits for its thread
+        delete m_Process;
+        m_Process = NULL;
+        m_IsProcessPaused = false;
+        m_IsProcessQueued.storeRelease(0);
+        finishProcess();
+    }
+
+    ///
+    ///  @fn        isProcessAttached : const
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminal::isProcessAttached() const {
+        return m_Process != NULL;
+    }
+
+    ///
+    ///  @fn        readProcess
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::readProcess() {
+        m_IsProcessQueued.storeRelease(0);
+        if (!m_Process) {
+            return;
+        }
+
+        // Leaves the output with the child until the next flush
+        qint64 pending = 0;
+        for (const PendingRun &run : qAsConst(m_Pending)) {
+            pending += run.text.size();
+        }
+        if (pending >= 256 * 1024) {
+            m_IsProcessPaused = true;
+            return;
+        }
+
+        // Checked first, so that no output is taken after the last call
+        bool isFinished = m_Process->isFinished();
+        QVector<QTerminalProcess::Chunk> chunks;
+        m_Process->take(chunks);
+        m_IsProcessPaused = false;
+
+        KGL_TRACE_SPAN("readProcess", chunks.size());
+        quint16 previous = m_Style;
+        for (const QTerminalProcess::Chunk &chunk : qAsConst(chunks)) {
+            if (m_Process->usesPty()) {
+                QString text;
+                m_ProcessOutput.decode(chunk.data.constData(), chunk.data.size(), text);
+                writeAnsi(text);
+            } else if (chunk.isError) {
+                m_Style = styleIndex(TextState::Error, false);
+                m_ProcessError.decode(chunk.data.constData(), chunk.data.size(), pendingText());
+            } else {
+                m_Style = styleIndex(TextState::Normal, false);
+                m_ProcessOutput.decode(chunk.data.constData(), chunk.data.size(), pendingText());
+            }
+        }
+
+        m_Style = previous;
+        if (isFinished) {
+            int exitCode = m_Process->exitCode();
+            delete m_Process;
+            m_Process = NULL;
+            finishProcess();
+            emit processFinished(exitCode);
+        }
+    }
+
+    ///
+    ///  @fn        forwardInput
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::forwardInput() {
+        // Hands every line read to the child and then reads the next one
+        m_IsForwardQueued = true;
+        enqueueRead([this](const QString &line) {
+            m_IsForwardQueued = false;
+            if (m_Process) {
+                m_Process->write(line.toUtf8() + '\n');
+                forwardInput();
+            }
+        });
+    }
+
+    ///
+    ///  @fn        finishProcess
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::finishProcess() {
+        flush();
+
+        // Stops reading unless the application queued reads of its own
+        if (m_IsForwardQueued && m_Reads.size() == 1 && m_IsReading) {
+            m_Reads.clear();
+            m_IsForwardQueued = false;
+            m_IsReading = false;
+            if (m_Backend == RenderBackend::Grid) {
+                m_Buffer.endInput();
+                updateViews();
+            }
+        }
+    }
+
+    ///
+    ///  @fn        updateWindowSize
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::updateWindowSize() {
+        if (!m_Process || !m_Process->usesPty()) {
+            return;
+        }
+
+        // Tells interactive tools how much room they have
+        QFontMetrics fm(m_Design.font());
+#if QT_VERSION >= QT_VERSION_CHECK(5, 11, 0)
+        int width = qMax(1, fm.horizontalAdvance(QLatin1Char('M')));
+#else
+        int width = qMax(1, fm.width(QLatin1Char('M')));
+#endif
+        QWidget *output = (m_Backend == RenderBackend::Grid) ? m_View->viewport() : m_Input->viewport();
+        m_Process->setWindowSize(output->width() / width, output->height() / qMax(1, fm.lineSpacing()));
+    }
+
+    ///
+    ///  @fn        showSearchBar
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::showSearchBar() {
+        // Creates the search on first use
+        if (!m_SearchBar) {
+            m_Search = new QTerminalSearch;
+            m_Search->setNotifier([this]() {
+                if (m_IsSearchQueued.testAndSetOrdered(0, 1)) {
+                    QMetaObject::invokeMethod(this, "updateSearch", Qt::QueuedConnection);
+                }
+            });
+
+            m_SearchBar = new QTerminalSearchBar;
+            m_SearchBar->setVisible(false);
+            m_Layout->addWidget(m_SearchBar);
+            connect(m_SearchBar, SIGNAL(patternChanged(QString, bool, bool)), this, SLOT(searchFor(QString, bool, bool)));
+            connect(m_SearchBar, SIGNAL(findNext()), this, SLOT(findNext()));
+            connect(m_SearchBar, SIGNAL(findPrevious()), this, SLOT(findPrevious()));
+            connect(m_SearchBar, SIGNAL(closed()), this, SLOT(hideSearchBar()));
+            connect(m_Input->verticalScrollBar(), SIGNAL(valueChanged(int)), this, SLOT(updateSearchHighlights()));
+        }
+
+        m_SearchBar->activate();
+    }
+
+    ///
+    ///  @fn        findNext
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::findNext() {
+        findMatch(false);
+    }
+
+    ///
+    ///  @fn        findPrevious
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::findPrevious() {
+        findMatch(true);
+    }
+
+    ///
+    ///  @fn        searchFor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::searchFor(const QString &pattern, bool isRegex, bool caseSensitive) {
+        m_Search->setPattern(pattern, isRegex, caseSensitive);
+        m_SearchLine = 0;
+        m_HasMatch = false;
+
+        if (m_View) {
+            m_View->setSearch(m_Search);
+        }
+
+        // Output still pending is searched along with the rest
+        flush();
+        searchNewLines();
+        updateSearch();
+    }
+
+    ///
+    ///  @fn        hideSearchBar
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::hideSearchBar() {
+        m_Search->setPattern(QString(), false, false);
+        m_HasMatch = false;
+
+        if (m_View) {
+            m_View->setSearch(NULL);
+        }
+
+        updateSearchHighlights();
+        if (m_MappedFile) {
+            m_FileView->setFocus();
+        } else if (m_Backend == RenderBackend::Grid) {
+            m_View->setFocus();
+        } else {
+            m_Input->setFocus();
+        }
+    }
+
+    ///
+    ///  @fn        updateSearch
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::updateSearch() {
+        m_IsSearchQueued.storeRelease(0);
+        if (!m_SearchBar || !m_SearchBar->isVisible()) {
+            return;
+        }
+
+        // Jumps to the first match below the top of the view once there is one
+        QTerminalSearch::Match match;
+        qint64 top = firstVisibleLine();
+        if (!m_HasMatch && m_Search->find(top, -1, false, match) && match.line >= top) {
+            showMatch(match);
+            return;
+        }
+
+        m_SearchBar->setStatus(m_HasMatch ? m_Search->indexOf(m_Match) : -1, m_Search->count(), m_Search->isValid());
+        if (m_Backend == RenderBackend::Grid) {
+            m_View->viewport()->update();
+        } else {
+            updateSearchHighlights();
+        }
+    }
+
+    ///
+    ///  @fn        updateSearchHighlights
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::updateSearchHighlights() {
+        if (m_Backend != RenderBackend::Document) {
+            return;
+        }
+
+        // Only the matches within the viewport are turned into selections
+        QList<QTextEdit::ExtraSelection> selections;
+        if (m_SearchBar && m_SearchBar->isVisible()) {
+            QTextDocument *doc = m_Input->document();
+            qint32 first = m_Input->cursorForPosition(QPoint(0, 0)).blockNumber();
+            qint32 last = m_Input->cursorForPosition(QPoint(0, m_Input->viewport()->height())).blockNumber();
+
+            for (const QTerminalSearch::Match &match : m_Search->matches(m_EvictedLines + first, m_EvictedLines + last)) {
+                QTextBlock block = doc->findBlockByNumber(static_cast<int>(match.line - m_EvictedLines));
+                if (!block.isValid() || match.start + match.length >= block.length()) {
+                    continue;
+                }
+
+                bool isCurrent = m_HasMatch && match.line == m_Match.line && match.start == m_Match.start;
+                QTextEdit::ExtraSelection selection;
+                selection.cursor = QTextCursor(doc);
+                selection.cursor.setPosition(block.position() + match.start);
+                selection.cursor.setPosition(block.position() + match.start + match.length, QTextCursor::KeepAnchor);
+                selection.format.setBackground(isCurrent ? QColor(255, 140, 0, 160) : QColor(255, 215, 0, 90));
+                selections.append(selection);
+            }
+        }
+
+        m_Input->setExtraSelections(selections);
+    }
+
+    ///
+    ///  @fn        searchNewLines
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::searchNewLines() {
+        if (!m_Search || m_Search->pattern().isEmpty()) {
+            return;
+        }
+
+        // Copies the lines that were not searched yet; the last one is
+        // passed again next time since it may still grow
+        QVector<QString> lines;
+        qint64 base = m_Buffer.evictedLines();
+        qint64 first = qMax(m_SearchLine, base);
+        for (qint64 i = first - base; i < m_Buffer.lineCount(); ++i) {
+            lines.append(m_Buffer.line(i).text);
+        }
+
+        m_Search->discardBefore(base);
+        m_SearchLine = base + m_Buffer.lineCount() - 1;
+        m_Search->append(first, lines);
+    }
+
+    ///
+    ///  @fn        firstVisibleLine
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint64 QTerminal::firstVisibleLine() const {
+        if (m_Backend == RenderBackend::Grid) {
+            return m_Buffer.evictedLines() + m_View->verticalScrollBar()->value();
+        }
+
+        return m_EvictedLines + m_Input->cursorForPosition(QPoint(0, 0)).blockNumber();
+    }
+
+    ///
+    ///  @fn        findMatch
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::findMatch(bool backwards) {
+        if (!m_Search) {
+            return;
+        }
+
+        // Continues from the current match or else from the top of the view
+        QTerminalSearch::Match match;
+        qint64 line = m_HasMatch ? m_Match.line : firstVisibleLine();
+        qint32 column = m_HasMatch ? m_Match.start : -1;
+        if (m_Search->find(line, column, backwards, match)) {
+            showMatch(match);
+        }
+    }
+
+    ///
+    ///  @fn        showMatch
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::showMatch(const QTerminalSearch::Match &match) {
+        m_Match = match;
+        m_HasMatch = true;
+
+        if (m_Backend == RenderBackend::Grid) {
+            m_View->showMatch(match);
+        } else {
+            // Centers the block unless it is visible already
+            QTextBlock block = m_Input->document()->findBlockByNumber(static_cast<int>(match.line - m_EvictedLines));
+            if (block.isValid()) {
+                QRectF rect = m_Input->document()->documentLayout()->blockBoundingRect(block);
+                QScrollBar *bar = m_Input->verticalScrollBar();
+                int height = m_Input->viewport()->height();
+                if (rect.top() < bar->value() || rect.bottom() > bar->value() + height) {
+                    bar->setValue(static_cast<int>(rect.top()) - height / 2);
+                }
+            }
+
+            updateSearchHighlights();
+        }
+
+        m_SearchBar->setStatus(m_Search->indexOf(match), m_Search->count(), m_Search->isValid());
+    }
+
+    ///
+    ///  @fn        addHighlightRule
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    int QTerminal::addHighlightRule(const QString &pattern, TextState state, PatternSyntax syntax, Qt::CaseSensitivity cs) {
+        return m_Highlighter.add(pattern, syntax, cs, styleIndex(state, false));
+    }
+
+    ///
+    ///  @fn        addHighlightRule
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    int QTerminal::addHighlightRule(const QString &pattern, const QColor &color, PatternSyntax syntax, Qt::CaseSensitivity cs) {
+        QAnsiParser::Attributes a = { TextState::Normal, color.rgba(), 0, false, false, false };
+        return m_Highlighter.add(pattern, syntax, cs, styleIndex(a));
+    }
+
+    ///
+    ///  @fn        removeHighlightRule
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::removeHighlightRule(int id) {
+        m_Highlighter.remove(id);
+    }
+
+    ///
+    ///  @fn        clearHighlightRules
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::clearHighlightRules() {
+        m_Highlighter.clear();
+    }
+
+    ///
+    ///  @fn        highlightPending
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::highlightPending() {
+        // Matches may span runs and batches, so the batch is searched as
+        // one text behind the open line; one more character of a longer
+        // line keeps '^' from matching where the context was cut
+        const QString &open = m_Buffer.line(m_Buffer.lineCount() - 1).text;
+        qint32 context = qMin(open.size(), HighlightContext);
+        qint32 from = (context < open.size()) ? 1 : 0;
+        QString text = open.right(context + from);
+        for (const PendingRun &run : qAsConst(m_Pending)) {
+            text += run.text;
+        }
+
+        QVector<QTerminalHighlighter::Span> spans;
+        m_Highlighter.match(text.constData(), text.size(), spans, from);
+        context += from;
+
+        // Spans within the open line were applied before; the part of a
+        // span that starts there is restyled in place
+        QVector<QTerminalHighlighter::Span> pending;
+        for (QTerminalHighlighter::Span span : qAsConst(spans)) {
+            qint32 end = span.start + span.length;
+            if (end <= context) {
+                continue;
+            }
+            if (span.start < context) {
+                restyleOpenLine(open.size() - context + span.start, context - span.start, span.style);
+                span.start = context;
+            }
+
+            span.start -= context;
+            span.length = end - context - span.start;
+            pending.append(span);
+        }
+
+        spans.swap(pending);
+        if (spans.isEmpty()) {
+            return;
+        }
+
+        QVector<PendingRun> runs;
+        auto append = [&runs](const QString &s, quint16 style) {
+            if (!runs.isEmpty() && runs.last().style == style) {
+                runs.last().text += s;
+            } else {
+                PendingRun run = { s, style };
+                runs.append(run);
+            }
+        };
+
+        // Splits the runs at the span boundaries
+        qint32 offset = 0, k = 0;
+        for (const PendingRun &run : qAsConst(m_Pending)) {
+            qint32 length = run.text.size();
+            for (qint32 position = 0; position < length; ) {
+                while (k < spans.size() && spans.at(k).start + spans.at(k).length <= offset + position) {
+                    ++k;
+                }
+
+                qint32 end;
+                if (k < spans.size() && spans.at(k).start <= offset + position) {
+                    end = qMin(length, spans.at(k).start + spans.at(k).length - offset);
+                    append(run.text.mid(position, end - position), spans.at(k).style);
+                } else {
+                    end = (k < spans.size()) ? qMin(length, spans.at(k).start - offset) : length;
+                    append(run.text.mid(position, end - position), run.style);
+                }
+                position = end;
+            }
+            offset += length;
+        }
+
+        m_Pending.swap(runs);
+    }
+
+    ///
+    ///  @fn        restyleOpenLine
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::restyleOpenLine(qint32 start, qint32 length, quint16 style) {
+        qint32 size = m_Buffer.line(m_Buffer.lineCount() - 1).text.size();
+        m_Buffer.restyleOpenLine(start, length, style);
+        if (m_Backend == RenderBackend::Grid) {
+            return;
+        }
+
+        // The open line ends where the output ends, in front of any input
+        QTextCursor tc(m_Input->document());
+        qint32 end = m_IsReading ? m_InitialPos : m_Input->document()->characterCount() - 1;
+        if (end - size + start < 0) {
+            return;
+        }
+
+        tc.setPosition(end - size + start);
+        tc.setPosition(end - size + start + length, QTextCursor::KeepAnchor);
+        tc.setCharFormat(m_Formats.at(style));
+    }
+
+    ///
+    ///  @fn        pendingText
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QString &QTerminal::pendingText() {
+        // Starts a new run if the format changed since the last write
+        if (m_Pending.isEmpty() || m_Pending.last().style != m_Style) {
+            PendingRun run;
+            run.style = m_Style;
+            m_Pending.append(run);
+        }
+
+        // Schedules the next batched edit
+        if (!m_FlushTimer->isActive()) {
+            m_FlushTimer->start();
+            m_BatchClock.start();
+        }
+
+        return m_Pending.last().text;
+    }
+
+    ///
+    ///  @fn        flush
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::flush() {
+        m_FlushTimer->stop();
+        if (m_Pending.isEmpty()) {
+            return;
+        }
+
+        // Measures the batch as a whole, never single writes
+        m_Stats.addFlushLatency(m_BatchClock.nsecsElapsed());
+        QElapsedTimer clock;
+        clock.start();
+
+        qint64 characters = 0;
+        for (const PendingRun &run : qAsConst(m_Pending)) {
+            characters += run.text.size();
+        }
+
+        KGL_TRACE_SPAN("flush", characters);
+
+        qint64 lines = outputLines();
+        applyPending();
+        m_Stats.addOutput(characters, outputLines() - lines);
+        m_Stats.addApplyTime(clock.nsecsElapsed());
+
+        // Takes the next batch from a child that had to wait
+        if (m_IsProcessPaused) {
+            readProcess();
+        }
+    }
+
+    ///
+    ///  @fn        applyPending
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::applyPending() {
+        if (!m_Highlighter.isEmpty()) {
+            highlightPending();
+        }
+
+        // Hands the batch to the log thread before it is consumed
+        if (m_Log != NULL) {
+            for (const PendingRun &run : qAsConst(m_Pending)) {
+                m_Log->append(run.text, attributesOf(run.style));
+            }
+        }
+
+        // Custom ANSI styles are recorded as their base state
+        if (m_Recorder != NULL) {
+            for (const PendingRun &run : qAsConst(m_Pending)) {
+                QAnsiParser::Attributes attributes = attributesOf(run.style);
+                m_Recorder->recordText(run.text, attributes.state, attributes.inverse);
+            }
+            m_Recorder->flush();
+        }
+
+        // The buffer holds the output; grid views paint straight from it
+        for (const PendingRun &run : qAsConst(m_Pending)) {
+            m_Buffer.append(run.text, run.style);
+        }
+
+        if (m_Backend == RenderBackend::Grid) {
+            m_Pending.clear();
+            updateViews();
+            searchNewLines();
+            return;
+        }
+
+        // Output goes in front of the input region while reading
+        QTextCursor tc(m_Input->document());
+        if (m_IsReading) {
+            tc.setPosition(m_InitialPos);
+        } else {
+            tc.movePosition(QTextCursor::End);
+        }
+
+        // Inserts all runs within one single edit block
+        qint32 start = tc.position();
+        tc.beginEditBlock();
+        for (const PendingRun &run : qAsConst(m_Pending)) {
+            tc.insertText(run.text, m_Formats.at(run.style));
+        }
+        tc.endEditBlock();
+
+        m_Pending.clear();
+
+        // Scrolls to the end only once per batch
+        if (m_IsReading) {
+            qint32 length = tc.position() - start;
+            m_InitialPos += length;
+            m_CaretPos += length;
+            m_Input->ensureCursorVisible();
+        } else {
+            m_Input->setTextCursor(tc);
+            m_Input->setCurrentCharFormat(m_Formats.at(m_Style));
+        }
+
+        trimDocument();
+        updateViews();
+        searchNewLines();
+    }
+
+    ///
+    ///  @fn        attributesOf
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QAnsiParser::Attributes QTerminal::attributesOf(quint16 style) const {
+        if (style >= 8)
+            return m_CustomStyles.at(style - 8);
+
+        QAnsiParser::Attributes a = { static_cast<TextState>(style / 2), 0, 0, false, false, (style & 1) != 0 };
+        return a;
+    }
+
+    ///
+    ///  @fn        trimDocument
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::trimDocument() {
+        QTextDocument *doc = m_Input->document();
+
+        // Drops the blocks of the lines the buffer evicted, but never the
+        // last block or the one the input starts in; those follow later
+        qint64 blocks = m_Buffer.evictedLines() - m_EvictedLines;
+        qint32 last = doc->blockCount() - 1;
+        if (m_IsReading) {
+            last = doc->findBlock(m_InitialPos).blockNumber();
+        }
+
+        blocks = qMin<qint64>(blocks, last);
+        if (blocks <= 0) {
+            return;
+        }
+
+        // Removes all blocks in front of the first kept one at once
+        qint32 length = doc->findBlockByNumber(static_cast<int>(blocks)).position();
+        QTextCursor tc(doc);
+        tc.setPosition(length, QTextCursor::KeepAnchor);
+        tc.removeSelectedText();
+
+        if (m_IsReading) {
+            m_InitialPos -= length;
+            m_CaretPos -= length;
+        }
+
+        m_EvictedLines += blocks;
+    }
+
+    ///
+    ///  @fn        rebuildDocument
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::rebuildDocument() {
+        m_Input->clear();
+        m_InitialPos = m_CaretPos = 0;
+
+        // Inserts every line of the buffer within one single edit block
+        QTextCursor tc(m_Input->document());
+        tc.beginEditBlock();
+        for (qint64 i = 0; i < m_Buffer.lineCount(); i++) {
+            const QTerminalBuffer::Line &line = m_Buffer.line(i);
+            if (i > 0) {
+                tc.insertText("\n");
+            }
+            for (const QTerminalBuffer::Run &run : line.runs) {
+                tc.insertText(line.text.mid(run.start, run.length), m_Formats.at(run.style));
+            }
+        }
+        tc.endEditBlock();
+
+        m_Input->setTextCursor(tc);
+        m_Input->setCurrentCharFormat(m_Formats.at(m_Style));
+
+        // The first block is the oldest line the buffer still holds
+        m_EvictedLines = m_Buffer.evictedLines();
+    }
+
+    ///
+    ///  @fn        bufferViews : const
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QList<QTerminalView *> QTerminal::bufferViews() const {
+        QList<QTerminalView *> views;
+        if (m_View) {
+            views.append(m_View);
+        }
+
+        // Views that were destroyed by their owner are skipped
+        for (const QPointer<QTerminalView> &view : m_Views) {
+            if (view) {
+                views.append(view.data());
+            }
+        }
+
+        return views;
+    }
+
+    ///
+    ///  @fn        updateViews
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::updateViews() {
+        for (QTerminalView *view : bufferViews()) {
+            view->updateContents();
+        }
+    }
+
+    ///
+    ///  @fn        readChar
+    ///  @author    Nicolas Kogler
+    ///  @date      October 21th, 2016
+    ///
+    QChar QTerminal::readChar() {
+        return parseChar(readPrivate());
+    }
+
+    ///
+    ///  @fn        readLine
+    ///  @author    Nicolas Kogler
+    ///  @date      October 21th, 2016
+    ///
+    QString QTerminal::readLine() {
+        QString s = readPrivate();
+
+        // Returns the entire line
+        return s;
+    }
+
+    ///
+    ///  @fn        readString
+    ///  @author    Nicolas Kogler
+    ///  @date      October 21th, 2016
+    ///
+    QString QTerminal::readString(quint32 size) {
+        QString s = readPrivate();
+
+        // Trims the string by size
+        return s.left(size);
+    }
+
+    ///
+    ///  @fn        readByte
+    ///  @author    Nicolas Kogler
+    ///  @date      October 21th, 2016
+    ///
+    quint8 QTerminal::readByte() {
+        return parseByte(readPrivate());
+    }
+
+    ///
+    ///  @fn        readUInt16
+    ///  @author    Nicolas Kogler
+    ///  @date      October 21th, 2016
+    ///
+    quint16 QTerminal::readUInt16() {
+        return parseUInt16(readPrivate());
+    }
+
+    ///
+    ///  @fn        readUInt32
+    ///  @author    Nicolas Kogler
+    ///  @date      October 21th, 2016
+    ///
+    quint32 QTerminal::readUInt32() {
+        return parseUInt32(readPrivate());
+    }
+
+    ///
+    ///  @fn        readUInt64
+    ///  @author    Nicolas Kogler
+    ///  @date      October 21th, 2016
+    ///
+    quint64 QTerminal::readUInt64() {
+        return parseUInt64(readPrivate());
+    }
+
+    ///
+    ///  @fn        readInt32
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint32 QTerminal::readInt32() {
+        return parseInt32(readPrivate());
+    }
+
+    ///
+    ///  @fn        readInt64
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint64 QTerminal::readInt64() {
+        return parseInt64(readPrivate());
+    }
+
+    ///
+    ///  @fn        readFloat
+    ///  @author    Nicolas Kogler
+    ///  @date      October 21th, 2016
+    ///
+    float QTerminal::readFloat() {
+        return parseFloat(readPrivate());
+    }
+
+    ///
+    ///  @fn        readDouble
+    ///  @author    Nicolas Kogler
+    ///  @date      October 21th, 2016
+    ///
+    double QTerminal::readDouble() {
+        return parseDouble(readPrivate());
+    }
+
+    ///
+    ///  @fn        readHex
+    ///  @author    Nicolas Kogler
+    ///  @date      October 21th, 2016
+    ///
+    quint64 QTerminal::readHex() {
+        return parseHex(readPrivate());
+    }
+
+    ///
+    ///  @fn        readLineAsync
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::readLineAsync(const std::function<void(const QString &)> &callback) {
+        // Defers the callback so that it never runs inside the key event
+        enqueueRead([this, callback](const QString &s) {
+            QTimer::singleShot(0, this, [callback, s]() {
+                callback(s);
+            });
+        });
+    }
+
+    ///
+    ///  @fn        readCharAsync
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::readCharAsync(const std::function<void(QChar)> &callback) {
+        readLineAsync([this, callback](const QString &s) {
+            callback(parseChar(s));
+        });
+    }
+
+    ///
+    ///  @fn        readStringAsync
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::readStringAsync(quint32 size, const std::function<void(const QString &)> &callback) {
+        readLineAsync([callback, size](const QString &s) {
+            callback(s.left(size));
+        });
+    }
+
+    ///
+    ///  @fn        readByteAsync
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::readByteAsync(const std::function<void(quint8)> &callback) {
+        readLineAsync([this, callback](const QString &s) {
+            callback(parseByte(s));
+        });
+    }
+
+    ///
+    ///  @fn        readUInt16Async
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::readUInt16Async(const std::function<void(quint16)> &callback) {
+        readLineAsync([this, callback](const QString &s) {
+            callback(parseUInt16(s));
+        });
+    }
+
+    ///
+    ///  @fn        readUInt32Async
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::readUInt32Async(const std::function<void(quint32)> &callback) {
+        readLineAsync([this, callback](const QString &s) {
+            callback(parseUInt32(s));
+        });
+    }
+
+    ///
+    ///  @fn        readUInt64Async
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::readUInt64Async(const std::function<void(quint64)> &callback) {
+        readLineAsync([this, callback](const QString &s) {
+            callback(parseUInt64(s));
+        });
+    }
+
+    ///
+    ///  @fn        readInt32Async
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::readInt32Async(const std::function<void(qint32)> &callback) {
+        readLineAsync([this, callback](const QString &s) {
+            callback(parseInt32(s));
+        });
+    }
+
+    ///
+    ///  @fn        readInt64Async
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::readInt64Async(const std::function<void(qint64)> &callback) {
+        readLineAsync([this, callback](const QString &s) {
+            callback(parseInt64(s));
+        });
+    }
+
+    ///
+    ///  @fn        readFloatAsync
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::readFloatAsync(const std::function<void(float)> &callback) {
+        readLineAsync([this, callback](const QString &s) {
+            callback(parseFloat(s));
+        });
+    }
+
+    ///
+    ///  @fn        readDoubleAsync
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::readDoubleAsync(const std::function<void(double)> &callback) {
+        readLineAsync([this, callback](const QString &s) {
+            callback(parseDouble(s));
+        });
+    }
+
+    ///
+    ///  @fn        readHexAsync
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::readHexAsync(const std::function<void(quint64)> &callback) {
+        readLineAsync([this, callback](const QString &s) {
+            callback(parseHex(s));
+        });
+    }
+
+    ///
+    ///  @fn        parseInteger
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    template <typename T>
+    T QTerminal::parseInteger(const QString &s, NumberFormat f, const char *kind, const char *range) {
+        T value;
+        m_Flag = TextState::Success;
+
+        switch (QNumberParser::parse(s.constData(), s.size(), f, value)) {
+        case QNumberParser::Status::Ok:
+            break;
+        case QNumberParser::Status::Invalid:
+            diagnoseInput(TextState::Error, QString("Entered text is not a %1.").arg(kind));
+            break;
+        case QNumberParser::Status::Overflow:
+            diagnoseInput(TextState::Warning, QString("Entered number exceeds %1 range.").arg(range));
+            break;
+        }
+
+        return value;
+    }
+
+    ///
+    ///  @fn        diagnoseInput
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::diagnoseInput(TextState state, const QString &message) {
+        quint16 style = m_Style;
+
+        // Writes the message in the state's format, then restores the old one
+        setCurrentState(state);
+        writeLine(message);
+        m_Style = style;
+
+        // Keeps the worst state of a read that reports several times
+        if (m_Flag != TextState::Error)
+            m_Flag = state;
+    }
+
+    ///
+    ///  @fn        diagnoseField
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::diagnoseField(qint32 index, QNumberParser::Status status) {
+        if (status == QNumberParser::Status::Invalid)
+            diagnoseInput(TextState::Error, QString("Entered value %1 is invalid.").arg(index + 1));
+        else if (status == QNumberParser::Status::Overflow)
+            diagnoseInput(TextState::Warning, QString("Entered value %1 exceeds its range.").arg(index + 1));
+    }
+
+    ///
+    ///  @fn        nextField
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminal::nextField(const QString &s, qint32 &position, qint32 &start, qint32 &length) {
+        const QChar *data = s.constData();
+        const qint32 size = s.size();
+
+        // Blanks, commas, semicolons and all kinds of line breaks separate values
+        auto isSeparator = [](QChar c) {
+            return c.isSpace() || c == QLatin1Char(',') || c == QLatin1Char(';');
+        };
+
+        while (position < size && isSeparator(data[position]))
+            ++position;
+        if (position == size)
+            return false;
+
+        start = position;
+        while (position < size && !isSeparator(data[position]))
+            ++position;
+
+        length = position - start;
+        return true;
+    }
+
+    ///
+    ///  @fn        parseValue
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QNumberParser::Status QTerminal::parseValue(const QChar *data, qint32 length, NumberFormat, float &value) {
+        bool result;
+        value = QString::fromRawData(data, length).toFloat(&result);
+        return result ? QNumberParser::Status::Ok : QNumberParser::Status::Invalid;
+    }
+
+    ///
+    ///  @fn        parseValue
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QNumberParser::Status QTerminal::parseValue(const QChar *data, qint32 length, NumberFormat, double &value) {
+        bool result;
+        value = QString::fromRawData(data, length).toDouble(&result);
+        return result ? QNumberParser::Status::Ok : QNumberParser::Status::Invalid;
+    }
+
+    ///
+    ///  @fn        parseValue
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QNumberParser::Status QTerminal::parseValue(const QChar *data, qint32 length, NumberFormat, QChar &value) {
+        value = data[0];
+        return length == 1 ? QNumberParser::Status::Ok : QNumberParser::Status::Overflow;
+    }
+
+    ///
+    ///  @fn        parseValue
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QNumberParser::Status QTerminal::parseValue(const QChar *data, qint32 length, NumberFormat, QString &value) {
+        value = QString(data, length);
+        return QNumberParser::Status::Ok;
+    }
+
+    ///
+    ///  @fn        parseChar
+    ///  @author    Nicolas Kogler
+    ///  @date      October 21th, 2016
+    ///
+    QChar QTerminal::parseChar(const QString &s) {
+        // Returns only the first character
+        return s.isEmpty() ? QChar() : s.at(0);
+    }
+
+    ///
+    ///  @fn        parseByte
+    ///  @author    Nicolas Kogler
+    ///  @date      October 21th, 2016
+    ///
+    quint8 QTerminal::parseByte(const QString &s) {
+        return parseInteger<quint8>(s, NumberFormat::Decimal, "number", "byte");
+    }
+
+    ///
+    ///  @fn        parseUInt16
+    ///  @author    Nicolas Kogler
+    ///  @date      October 21th, 2016
+    ///
+    quint16 QTerminal::parseUInt16(const QString &s) {
+        return parseInteger<quint16>(s, NumberFormat::Decimal, "number", "short");
+    }
+
+    ///
+    ///  @fn        parseUInt32
+    ///  @author    Nicolas Kogler
+    ///  @date      October 21th, 2016
+    ///
+    quint32 QTerminal::parseUInt32(const QString &s) {
+        return parseInteger<quint32>(s, NumberFormat::Decimal, "number", "integer");
+    }
+
+    ///
+    ///  @fn        parseUInt64
+    ///  @author    Nicolas Kogler
+    ///  @date      October 21th, 2016
+    ///
+    quint64 QTerminal::parseUInt64(const QString &s) {
+        return parseInteger<quint64>(s, NumberFormat::Decimal, "number", "long");
+    }
+
+    ///
+    ///  @fn        parseInt32
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint32 QTerminal::parseInt32(const QString &s) {
+        return parseInteger<qint32>(s, NumberFormat::Decimal, "number", "integer");
+    }
+
+    ///
+    ///  @fn        parseInt64
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    qint64 QTerminal::parseInt64(const QString &s) {
+        return parseInteger<qint64>(s, NumberFormat::Decimal, "number", "long");
+    }
+
+    ///
+    ///  @fn        parseFloat
+    ///  @author    Nicolas Kogler
+    ///  @date      October 21th, 2016
+    ///
+    float QTerminal::parseFloat(const QString &s) {
+        m_Flag = TextState::Success;
+
+        // Attempts to parse the string
+        bool result;
+        float f = s.toFloat(&result);
+        if (!result)
+            diagnoseInput(TextState::Error, "Entered text is not a floating-point number.");
+
+        return f;
+    }
+
+    ///
+    ///  @fn        parseDouble
+    ///  @author    Nicolas Kogler
+    ///  @date      October 21th, 2016
+    ///
+    double QTerminal::parseDouble(const QString &s) {
+        m_Flag = TextState::Success;
+
+        // Attempts to parse the string
+        bool result;
+        double f = s.toDouble(&result);
+        if (!result)
+            diagnoseInput(TextState::Error, "Entered text is not a floating-point number.");
+
+        return f;
+    }
+
+    ///
+    ///  @fn        parseHex
+    ///  @author    Nicolas Kogler
+    ///  @date      October 21th, 2016
+    ///
+    quint64 QTerminal::parseHex(const QString &s) {
+        return parseInteger<quint64>(s, NumberFormat::Hexadecimal, "hex number", "long");
+    }
+
+
+    ///
+    ///  @fn        writeChar
+    ///  @author    Nicolas Kogler
+    ///  @date      October 21th, 2016
     ///
     void QTerminal::writeChar(const QChar &c) {
-        QTextCursor tc = m_Input->textCursor();
-        tc.insertText(QString(c), m_Input->currentCharFormat());
-        tc.movePosition(QTextCursor::End);
-        m_Input->setTextCursor(tc);
+        KGL_TRACE_SPAN("writeChar");
+        pendingText() += c;
     }
 
     ///
@@ -522,11 +2590,10 @@ namespace kgl {
     ///  @date      October 21th, 2016
     ///
     void QTerminal::writeLine(const QString &l) {
-        QTextCursor tc = m_Input->textCursor();
-        tc.insertText(l, m_Input->currentCharFormat());
-        tc.insertText("\n");
-        tc.movePosition(QTextCursor::End);
-        m_Input->setTextCursor(tc);
+        KGL_TRACE_SPAN("writeLine", l.size());
+        QString &text = pendingText();
+        text += l;
+        text += QLatin1Char('\n');
     }
 
     ///
@@ -535,10 +2602,241 @@ namespace kgl {
     ///  @date      October 20th, 2016
     ///
     void QTerminal::writeString(const QString &s) {
-        QTextCursor tc = m_Input->textCursor();
-        tc.insertText(s, m_Input->currentCharFormat());
-        tc.movePosition(QTextCursor::End);
-        m_Input->setTextCursor(tc);
+        KGL_TRACE_SPAN("writeString", s.size());
+        pendingText() += s;
+    }
+
+    ///
+    ///  @fn        writeFormattedPrivate
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::writeFormattedPrivate(const char *format, const QFormatArgument *args, qint32 count) {
+        KGL_TRACE_SPAN("writeFormatted", count);
+        const quint16 style = m_Style;
+        QString *text = NULL;
+        QUtf8Decoder decoder;
+        qint32 argument = 0;
+        int start = 0;
+        int i = 0;
+
+        // The pending run changes with every style tag
+        auto out = [&]() -> QString & {
+            if (text == NULL)
+                text = &pendingText();
+            return *text;
+        };
+        auto literal = [&](int end) {
+            if (end > start)
+                decoder.decode(format + start, end - start, out());
+        };
+
+        while (format[i] != '\0') {
+            const char c = format[i];
+            QFormatString::Spec spec = { 0, -1, '\0', false };
+            QFormatString::Tag tag = { -1, false };
+            int next;
+
+            if ((c == '{' || c == '}') && format[i + 1] == c) {
+                // Escaped brace
+                literal(i + 1);
+                start = i = i + 2;
+            } else if (c == '{' && format[i + 1] == '!' &&
+                       (next = QFormatString::parseTag(format, i + 2, tag)) >= 0) {
+                literal(i);
+                m_Style = (tag.state < 0) ? style
+                        : styleIndex(static_cast<TextState>(tag.state), tag.highlight);
+                text = NULL;
+                start = i = next;
+            } else if (c == '{' && argument < count &&
+                       (next = QFormatString::parseSpec(format, i + 1, spec)) >= 0 &&
+                       QFormatString::accepts(spec, args[argument].m_Category)) {
+                literal(i);
+                appendArgument(out(), args[argument++], spec);
+                start = i = next;
+            } else {
+                ++i;
+            }
+        }
+
+        literal(i);
+        m_Style = style;
+    }
+
+    ///
+    ///  @fn        appendArgument
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::appendArgument(QString &out, const QFormatArgument &arg, const QFormatString::Spec &spec) {
+        const qint32 before = out.size();
+        const QFormatArgument::Value &v = arg.m_Value;
+
+        switch (arg.m_Category) {
+        case QFormatString::Integer: {
+            QNumberFormatter::Options options = m_Number;
+            switch (spec.type) {
+            case 'x': options.format = NumberFormat::Hexadecimal; break;
+            case 'o': options.format = NumberFormat::Octal;       break;
+            case 'b': options.format = NumberFormat::Binary;      break;
+            default:  options.format = NumberFormat::Decimal;     break;
+            }
+            if (spec.width > 0) {
+                options.width = spec.width;
+                options.fill = QLatin1Char(spec.zero ? '0' : ' ');
+            }
+
+            if (arg.m_Signed)
+                QNumberFormatter::append(v.i, options, out);
+            else
+                QNumberFormatter::append(v.n, options, out);
+            return;
+        }
+
+        case QFormatString::Float: {
+            FloatFormat f = FloatFormat::Shortest;
+            if (spec.type == 'f') f = FloatFormat::Fixed;
+            if (spec.type == 'e') f = FloatFormat::Scientific;
+
+            qint32 precision = spec.precision < 0 ? 6 : spec.precision;
+            if (arg.m_Single)
+                QFloatFormatter::append(v.f, f, precision, out);
+            else
+                QFloatFormatter::append(v.d, f, precision, out);
+            break;
+        }
+
+        case QFormatString::String:
+            if (arg.m_Kind == QFormatArgument::Latin1) {
+                out.append(*v.l);
+            } else if (arg.m_Kind == QFormatArgument::Utf8) {
+                QUtf8Decoder decoder;
+                decoder.decode(v.u, qstrlen(v.u), out);
+            } else if (arg.m_Kind == QFormatArgument::Bytes) {
+                QUtf8Decoder decoder;
+                decoder.decode(v.a->constData(), v.a->size(), out);
+            } else {
+                out.append(*v.s);
+            }
+            break;
+
+        case QFormatString::Char:
+            out.append(QChar(v.c));
+            break;
+
+        case QFormatString::Bool:
+            out.append(QLatin1String(v.b ? "true" : "false"));
+            break;
+        }
+
+        // Right-aligns within the width; zeroes go behind the sign
+        const qint32 missing = spec.width - (out.size() - before);
+        if (missing > 0) {
+            qint32 at = before;
+            QChar fill = QLatin1Char(' ');
+            if (spec.zero) {
+                fill = QLatin1Char('0');
+                if (out.at(at) == QLatin1Char('-'))
+                    ++at;
+            }
+
+            const qint32 size = out.size();
+            out.resize(size + missing);
+            QChar *data = out.data();
+            std::copy_backward(data + at, data + size, data + size + missing);
+            std::fill(data + at, data + at + missing, fill);
+        }
+    }
+
+    ///
+    ///  @fn        stream
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminal::Stream QTerminal::stream() {
+        return Stream(this);
+    }
+
+    ///
+    ///  @fn        post
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::post(const QString &s, TextState state, bool highlight) {
+        KGL_TRACE_SPAN("post", s.size());
+        m_Stats.addPosted();
+        m_Queue.push(s, state, highlight);
+
+        // Only the first record of a batch wakes up the GUI thread
+        if (m_IsDrainQueued.testAndSetOrdered(0, 1)) {
+            QMetaObject::invokeMethod(this, "drainQueue", Qt::QueuedConnection);
+        }
+    }
+
+    ///
+    ///  @fn        drainQueue
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::drainQueue() {
+        // Re-arms the wake-up before draining, so that records pushed
+        // from now on are guaranteed to schedule another drain
+        m_IsDrainQueued.storeRelease(0);
+
+        QTerminalQueue::Record record;
+        quint16 previous = m_Style;
+        int count = 0;
+        while (count++ < 65536 && m_Queue.pop(record)) {
+            m_Style = styleIndex(record.state, record.highlight);
+            pendingText() += record.text;
+        }
+
+        m_Stats.addDrained(count - 1);
+
+        // Restores the format of the GUI thread's own writes
+        m_Style = previous;
+
+        // Yields to the event loop if producers are still ahead
+        if (count > 65536 && m_IsDrainQueued.testAndSetOrdered(0, 1)) {
+            QMetaObject::invokeMethod(this, "drainQueue", Qt::QueuedConnection);
+        }
+    }
+
+    ///
+    ///  @fn        writeAnsi
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::writeAnsi(const QString &s) {
+        KGL_TRACE_SPAN("writeAnsi", s.size());
+        quint16 previous = m_Style;
+        m_Style = styleIndex(m_Ansi.attributes());
+
+        AnsiHandler handler;
+        handler.terminal = this;
+        m_Ansi.parse(s.constData(), s.size(), handler);
+
+        // Restores the format of the other 'write' operations
+        m_Style = previous;
+    }
+
+    ///
+    ///  @fn        writeBytes
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::writeBytes(const char *data, qint64 length) {
+        KGL_TRACE_SPAN("writeBytes", length);
+        m_Utf8.decode(data, length, pendingText());
+    }
+
+    ///
+    ///  @fn        writeBytes
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::writeBytes(const QByteArray &bytes) {
+        writeBytes(bytes.constData(), bytes.size());
     }
 
     ///
@@ -574,19 +2872,58 @@ namespace kgl {
     ///  @date      October 21th, 2016
     ///
     void QTerminal::writeUInt64(quint64 b, NumberFormat f) {
-        // Determines the number base
-        qint32 base;
-        switch (f) {
-        case NumberFormat::Binary:      base = 1;  break;
-        case NumberFormat::Octal:       base = 8;  break;
-        case NumberFormat::Decimal:     base = 10; break;
-        case NumberFormat::Hexadecimal: base = 16; break;
-        default:                        base = 10; break;
-        }
+        KGL_TRACE_SPAN("writeNumber");
+        QNumberFormatter::Options options = m_Number;
+        options.format = f;
+        QNumberFormatter::append(b, options, pendingText());
+    }
+
+    ///
+    ///  @fn        writeUInt8s
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::writeUInt8s(const quint8 *values, qint32 count, NumberFormat f, const QString &separator) {
+        KGL_TRACE_SPAN("writeNumbers", count);
+        QNumberFormatter::Options options = m_Number;
+        options.format = f;
+        appendNumbers(values, count, options, separator, pendingText());
+    }
+
+    ///
+    ///  @fn        writeUInt16s
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::writeUInt16s(const quint16 *values, qint32 count, NumberFormat f, const QString &separator) {
+        KGL_TRACE_SPAN("writeNumbers", count);
+        QNumberFormatter::Options options = m_Number;
+        options.format = f;
+        appendNumbers(values, count, options, separator, pendingText());
+    }
+
+    ///
+    ///  @fn        writeUInt32s
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::writeUInt32s(const quint32 *values, qint32 count, NumberFormat f, const QString &separator) {
+        KGL_TRACE_SPAN("writeNumbers", count);
+        QNumberFormatter::Options options = m_Number;
+        options.format = f;
+        appendNumbers(values, count, options, separator, pendingText());
+    }
 
-        // Converts the number
-        QString s = QString::number(b, base);
-        writeString(s);
+    ///
+    ///  @fn        writeUInt64s
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::writeUInt64s(const quint64 *values, qint32 count, NumberFormat f, const QString &separator) {
+        KGL_TRACE_SPAN("writeNumbers", count);
+        QNumberFormatter::Options options = m_Number;
+        options.format = f;
+        appendNumbers(values, count, options, separator, pendingText());
     }
 
     ///
@@ -594,9 +2931,9 @@ namespace kgl {
     ///  @author    Nicolas Kogler
     ///  @date      October 21th, 2016
     ///
-    void QTerminal::writeFloat(float b) {
-        QString s = QString::number(b, 'f', 6);
-        writeString(s);
+    void QTerminal::writeFloat(float b, FloatFormat f, int precision) {
+        KGL_TRACE_SPAN("writeNumber");
+        QFloatFormatter::append(b, f, precision, pendingText());
     }
 
     ///
@@ -604,8 +2941,242 @@ namespace kgl {
     ///  @author    Nicolas Kogler
     ///  @date      October 21th, 2016
     ///
-    void QTerminal::writeDouble(double b) {
-        QString s = QString::number(b, 'f', 12);
-        writeString(s);
+    void QTerminal::writeDouble(double b, FloatFormat f, int precision) {
+        KGL_TRACE_SPAN("writeNumber");
+        QFloatFormatter::append(b, f, precision, pendingText());
+    }
+
+    ///
+    ///  @fn        writeFloats
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::writeFloats(const float *values, qint32 count, FloatFormat f, int precision, const QString &separator) {
+        KGL_TRACE_SPAN("writeNumbers", count);
+        appendFloats(values, count, f, precision, separator, pendingText());
+    }
+
+    ///
+    ///  @fn        writeDoubles
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::writeDoubles(const double *values, qint32 count, FloatFormat f, int precision, const QString &separator) {
+        KGL_TRACE_SPAN("writeNumbers", count);
+        appendFloats(values, count, f, precision, separator, pendingText());
+    }
+
+
+    ///
+    ///  @fn        Stream::Stream
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminal::Stream::Stream(QTerminal *terminal)
+        : m_Terminal(terminal)
+        , m_Number(terminal->m_Number)
+        , m_Float(FloatFormat::Shortest)
+        , m_Precision(6)
+        , m_State(TextState::Normal)
+        , m_Style(terminal->m_Style)
+        , m_Highlight(false) {
+        // Custom ANSI styles fall back to normal text once a manipulator is used
+        if (m_Style < 8) {
+            m_State = static_cast<TextState>(m_Style / 2);
+            m_Highlight = (m_Style & 1) != 0;
+        }
+    }
+
+    ///
+    ///  @fn        Stream::Stream
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminal::Stream::Stream(Stream &&other)
+        : m_Terminal(other.m_Terminal)
+        , m_Number(other.m_Number)
+        , m_Float(other.m_Float)
+        , m_Precision(other.m_Precision)
+        , m_State(other.m_State)
+        , m_Style(other.m_Style)
+        , m_Highlight(other.m_Highlight) {
+        m_Runs.swap(other.m_Runs);
+        m_Text.swap(other.m_Text);
+        other.m_Terminal = NULL;
+    }
+
+    ///
+    ///  @fn        Stream::~Stream
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminal::Stream::~Stream() {
+        if (m_Terminal == NULL)
+            return;
+
+        KGL_TRACE_SPAN("writeStream", m_Runs.size());
+
+        // Hands every run over at once; the terminal's own style is kept
+        quint16 style = m_Terminal->m_Style;
+        for (const PendingRun &run : m_Runs) {
+            m_Terminal->m_Style = run.style;
+            m_Terminal->pendingText() += run.text;
+        }
+        if (!m_Text.isEmpty()) {
+            m_Terminal->m_Style = m_Style;
+            m_Terminal->pendingText() += m_Text;
+        }
+
+        m_Terminal->m_Style = style;
+    }
+
+    ///
+    ///  @fn        Stream::setStyle
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminal::Stream::setStyle(quint16 style) {
+        if (style == m_Style)
+            return;
+
+        // Closes the current run; text of the new style starts a fresh one
+        if (!m_Text.isEmpty()) {
+            PendingRun run;
+            run.text.swap(m_Text);
+            run.style = m_Style;
+            m_Runs.append(run);
+        }
+
+        m_Style = style;
+    }
+
+    ///
+    ///  @fn        Stream::precision
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminal::Stream &QTerminal::Stream::precision(int digits) {
+        m_Precision = digits;
+        return *this;
+    }
+
+    ///
+    ///  @fn        Stream::operator<<
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminal::Stream &QTerminal::Stream::operator<<(const QString &s) {
+        m_Text += s;
+        return *this;
+    }
+
+    ///
+    ///  @fn        Stream::operator<<
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminal::Stream &QTerminal::Stream::operator<<(const QLatin1String &s) {
+        m_Text += s;
+        return *this;
+    }
+
+    ///
+    ///  @fn        Stream::operator<<
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminal::Stream &QTerminal::Stream::operator<<(const char *s) {
+        QUtf8Decoder decoder;
+        decoder.decode(s, qstrlen(s), m_Text);
+        if (decoder.hasPendingBytes())
+            m_Text += QChar(QChar::ReplacementCharacter);
+
+        return *this;
+    }
+
+    ///
+    ///  @fn        Stream::operator<<
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminal::Stream &QTerminal::Stream::operator<<(const QByteArray &bytes) {
+        QUtf8Decoder decoder;
+        decoder.decode(bytes.constData(), bytes.size(), m_Text);
+        if (decoder.hasPendingBytes())
+            m_Text += QChar(QChar::ReplacementCharacter);
+
+        return *this;
+    }
+
+    ///
+    ///  @fn        Stream::operator<<
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminal::Stream &QTerminal::Stream::operator<<(QChar c) {
+        m_Text += c;
+        return *this;
+    }
+
+    ///
+    ///  @fn        Stream::operator<<
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminal::Stream &QTerminal::Stream::operator<<(char c) {
+        m_Text += QLatin1Char(c);
+        return *this;
+    }
+
+    ///
+    ///  @fn        Stream::operator<<
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminal::Stream &QTerminal::Stream::operator<<(bool b) {
+        m_Text += QLatin1String(b ? "true" : "false");
+        return *this;
+    }
+
+    ///
+    ///  @fn        Stream::operator<<
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminal::Stream &QTerminal::Stream::operator<<(TextState state) {
+        m_State = state;
+        setStyle(styleIndex(m_State, m_Highlight));
+        return *this;
+    }
+
+    ///
+    ///  @fn        Stream::operator<<
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminal::Stream &QTerminal::Stream::operator<<(Highlight highlight) {
+        m_Highlight = highlight == Highlight::On;
+        setStyle(styleIndex(m_State, m_Highlight));
+        return *this;
+    }
+
+    ///
+    ///  @fn        Stream::operator<<
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminal::Stream &QTerminal::Stream::operator<<(NumberFormat f) {
+        m_Number.format = f;
+        return *this;
+    }
+
+    ///
+    ///  @fn        Stream::operator<<
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminal::Stream &QTerminal::Stream::operator<<(FloatFormat f) {
+        m_Float = f;
+        return *this;
     }
 }
@@ -0,0 +1,150 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+
+//
+//  Included headers
+//
+#include <KGL/Widgets/QTerminalSearchBar.hpp>
+#include <QHBoxLayout>
+#include <QKeyEvent>
+#include <QToolButton>
+
+
+namespace kgl {
+
+    ///
+    ///  @fn        Default constructor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalSearchBar::QTerminalSearchBar(QWidget *parent)
+        : QWidget(parent),
+          m_Pattern(new QLineEdit),
+          m_IsRegex(new QCheckBox("Regex")),
+          m_CaseSensitive(new QCheckBox("Match case")),
+          m_Status(new QLabel) {
+        QToolButton *previous = new QToolButton, *next = new QToolButton, *close = new QToolButton;
+        previous->setArrowType(Qt::UpArrow);
+        previous->setToolTip("Previous match (Shift+Return)");
+        next->setArrowType(Qt::DownArrow);
+        next->setToolTip("Next match (Return)");
+        close->setText("x");
+        close->setToolTip("Close (Escape)");
+        close->setAutoRaise(true);
+        m_Pattern->setPlaceholderText("Find");
+        m_Pattern->installEventFilter(this);
+
+        QHBoxLayout *layout = new QHBoxLayout;
+        layout->setContentsMargins(4, 2, 4, 2);
+        layout->addWidget(m_Pattern, 1);
+        layout->addWidget(m_Status);
+        layout->addWidget(previous);
+        layout->addWidget(next);
+        layout->addWidget(m_IsRegex);
+        layout->addWidget(m_CaseSensitive);
+        layout->addWidget(close);
+        setLayout(layout);
+
+        connect(m_Pattern, SIGNAL(textChanged(QString)), this, SLOT(emitPatternChanged()));
+        connect(m_IsRegex, SIGNAL(toggled(bool)), this, SLOT(emitPatternChanged()));
+        connect(m_CaseSensitive, SIGNAL(toggled(bool)), this, SLOT(emitPatternChanged()));
+        connect(previous, SIGNAL(clicked()), this, SIGNAL(findPrevious()));
+        connect(next, SIGNAL(clicked()), this, SIGNAL(findNext()));
+        connect(close, SIGNAL(clicked()), this, SLOT(hide()));
+        connect(close, SIGNAL(clicked()), this, SIGNAL(closed()));
+    }
+
+    ///
+    ///  @fn        Destructor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalSearchBar::~QTerminalSearchBar() {
+    }
+
+
+    ///
+    ///  @fn        activate
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalSearchBar::activate() {
+        show();
+        m_Pattern->setFocus();
+        m_Pattern->selectAll();
+    }
+
+    ///
+    ///  @fn        setStatus
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalSearchBar::setStatus(qint32 current, qint32 count, bool isValid) {
+        if (!isValid) {
+            m_Status->setText("Invalid expression");
+        } else if (m_Pattern->text().isEmpty()) {
+            m_Status->clear();
+        } else if (current < 0) {
+            m_Status->setText(QString("%1 matches").arg(count));
+        } else {
+            m_Status->setText(QString("%1 of %2").arg(current + 1).arg(count));
+        }
+    }
+
+
+    ///
+    ///  @fn        eventFilter
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    bool QTerminalSearchBar::eventFilter(QObject *o, QEvent *e) {
+        if (o == m_Pattern && e->type() == QEvent::KeyPress) {
+            QKeyEvent *ke = static_cast<QKeyEvent *>(e);
+            if (ke->key() == Qt::Key_Return || ke->key() == Qt::Key_Enter) {
+                if (ke->modifiers() & Qt::ShiftModifier) {
+                    emit findPrevious();
+                } else {
+                    emit findNext();
+                }
+                return true;
+            }
+            if (ke->key() == Qt::Key_Escape) {
+                hide();
+                emit closed();
+                return true;
+            }
+        }
+
+        return QWidget::eventFilter(o, e);
+    }
+
+    ///
+    ///  @fn        emitPatternChanged
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalSearchBar::emitPatternChanged() {
+        emit patternChanged(m_Pattern->text(), m_IsRegex->isChecked(), m_CaseSensitive->isChecked());
+    }
+}
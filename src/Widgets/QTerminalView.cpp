@@ -0,0 +1,454 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+
+//
+//  Included headers
+//
+#include <KGL/Widgets/QTerminalView.hpp>
+#include <KGL/Core/QTerminalTrace.hpp>
+#include <QApplication>
+#include <QClipboard>
+#include <QElapsedTimer>
+#include <QKeyEvent>
+#include <QPainter>
+#include <QScrollBar>
+
+
+namespace kgl {
+
+    ///
+    ///  @fn        Default constructor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalView::QTerminalView(QWidget *parent)
+        : QAbstractScrollArea(parent),
+          m_Source(NULL),
+          m_Buffer(NULL),
+          m_Search(NULL),
+          m_Stats(NULL),
+          m_EvictedLines(0),
+          m_CellWidth(1),
+          m_CellHeight(1),
+          m_Ascent(0),
+          m_FollowOutput(true),
+          m_HasMatch(false) {
+        setFrameShape(QFrame::NoFrame);
+        setFocusPolicy(Qt::StrongFocus);
+        viewport()->setAttribute(Qt::WA_OpaquePaintEvent);
+        updateMetrics();
+    }
+
+    ///
+    ///  @fn        Destructor
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QTerminalView::~QTerminalView() {
+    }
+
+
+    ///
+    ///  @fn        setSource
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalView::setSource(const QTerminalLineSource *source) {
+        m_Source = source;
+        m_Buffer = NULL;
+        m_EvictedLines = source ? source->evictedLines() : 0;
+        updateScrollBars();
+        if (m_FollowOutput) {
+            scrollToBottom();
+        } else {
+            verticalScrollBar()->setValue(0);
+            horizontalScrollBar()->setValue(0);
+        }
+
+        viewport()->update();
+    }
+
+    ///
+    ///  @fn        setBuffer
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalView::setBuffer(QTerminalBuffer *buffer) {
+        setSource(buffer);
+        m_Buffer = buffer;
+    }
+
+    ///
+    ///  @fn        setFollowOutput
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalView::setFollowOutput(bool follow) {
+        m_FollowOutput = follow;
+    }
+
+    ///
+    ///  @fn        setDesign
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalView::setDesign(const QTerminalDesign &design) {
+        m_Design = design;
+        updateMetrics();
+        updateScrollBars();
+        viewport()->update();
+    }
+
+    ///
+    ///  @fn        setFormats
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalView::setFormats(const QVector<QTextCharFormat> &formats) {
+        m_Formats = formats;
+        viewport()->update();
+    }
+
+    ///
+    ///  @fn        setSearch
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalView::setSearch(const QTerminalSearch *search) {
+        m_Search = search;
+        m_HasMatch = false;
+        viewport()->update();
+    }
+
+    ///
+    ///  @fn        setStats
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalView::setStats(QTerminalStats *stats) {
+        m_Stats = stats;
+    }
+
+    ///
+    ///  @fn        showMatch
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalView::showMatch(const QTerminalSearch::Match &match) {
+        m_Match = match;
+        m_HasMatch = true;
+
+        // Centers the line unless it is visible already
+        qint64 index = match.line - (m_Source ? m_Source->evictedLines() : 0);
+        int rows = viewport()->height() / m_CellHeight;
+        QScrollBar *bar = verticalScrollBar();
+        if (index < bar->value() || index >= bar->value() + rows) {
+            bar->setValue(static_cast<int>(qMax(Q_INT64_C(0), index - rows / 2)));
+        }
+
+        int x = match.start * m_CellWidth, width = match.length * m_CellWidth;
+        bar = horizontalScrollBar();
+        if (x < bar->value() || x + width > bar->value() + viewport()->width()) {
+            bar->setValue(x - viewport()->width() / 3);
+        }
+
+        viewport()->update();
+    }
+
+    ///
+    ///  @fn        updateContents
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalView::updateContents() {
+        QScrollBar *bar = verticalScrollBar();
+        bool isAtBottom = bar->value() >= bar->maximum();
+        int value = bar->value();
+
+        // Keeps the visible lines in place if the top was trimmed
+        qint64 evicted = m_Source ? m_Source->evictedLines() - m_EvictedLines : 0;
+        m_EvictedLines += evicted;
+
+        updateScrollBars();
+        if (isAtBottom && m_FollowOutput) {
+            scrollToBottom();
+        } else {
+            bar->setValue(static_cast<int>(qMax(Q_INT64_C(0), value - evicted)));
+        }
+
+        viewport()->update();
+    }
+
+    ///
+    ///  @fn        scrollToBottom
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalView::scrollToBottom() {
+        verticalScrollBar()->setValue(verticalScrollBar()->maximum());
+    }
+
+
+    ///
+    ///  @fn        updateMetrics
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalView::updateMetrics() {
+        QFontMetrics fm(m_Design.font());
+#if QT_VERSION >= QT_VERSION_CHECK(5, 11, 0)
+        m_CellWidth = qMax(1, fm.horizontalAdvance(QLatin1Char('M')));
+#else
+        m_CellWidth = qMax(1, fm.width(QLatin1Char('M')));
+#endif
+        m_CellHeight = qMax(1, fm.lineSpacing());
+        m_Ascent = fm.ascent();
+        horizontalScrollBar()->setSingleStep(m_CellWidth);
+    }
+
+    ///
+    ///  @fn        updateScrollBars
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalView::updateScrollBars() {
+        qint64 lines = m_Source ? m_Source->lineCount() : 0;
+        qint64 columns = m_Source ? m_Source->maximumLength() + 1 : 0;
+        if (m_Buffer) {
+            columns += m_Buffer->input().size();
+        }
+        int rows = viewport()->height() / m_CellHeight;
+
+        // The vertical bar scrolls by lines, the horizontal one by pixels
+        verticalScrollBar()->setPageStep(qMax(1, rows));
+        verticalScrollBar()->setRange(0, static_cast<int>(qBound(Q_INT64_C(0), lines - rows, Q_INT64_C(INT_MAX))));
+        horizontalScrollBar()->setPageStep(viewport()->width());
+        horizontalScrollBar()->setRange(0, static_cast<int>(qMax(Q_INT64_C(0),
+                columns * m_CellWidth - viewport()->width())));
+    }
+
+    ///
+    ///  @fn        foreground
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QColor QTerminalView::foreground(quint16 style) const {
+        if (style < m_Formats.size() && m_Formats.at(style).hasProperty(QTextFormat::ForegroundBrush)) {
+            return m_Formats.at(style).foreground().color();
+        }
+
+        return m_Design.textColor();
+    }
+
+    ///
+    ///  @fn        background
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    QColor QTerminalView::background(quint16 style) const {
+        if (style < m_Formats.size() && m_Formats.at(style).hasProperty(QTextFormat::BackgroundBrush)) {
+            return m_Formats.at(style).background().color();
+        }
+
+        return QColor();
+    }
+
+    ///
+    ///  @fn        paintText
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalView::paintText(QPainter &p, int x, int y, const QString &text, quint16 style) {
+        int width = text.size() * m_CellWidth;
+        if (x + width < 0 || x > viewport()->width()) {
+            return;
+        }
+
+        QColor back = background(style);
+        if (back.isValid()) {
+            p.fillRect(x, y, width, m_CellHeight, back);
+        }
+
+        // Switches the font only for bold or underlined runs
+        bool isBold = false, isUnderline = false;
+        if (style < m_Formats.size()) {
+            isBold = m_Formats.at(style).fontWeight() > QFont::Normal;
+            isUnderline = m_Formats.at(style).fontUnderline();
+        }
+        if (p.font().bold() != isBold || p.font().underline() != isUnderline) {
+            QFont font = m_Design.font();
+            font.setBold(isBold);
+            font.setUnderline(isUnderline);
+            p.setFont(font);
+        }
+
+        p.setPen(foreground(style));
+        p.drawText(x, y + m_Ascent, text);
+    }
+
+
+    ///
+    ///  @fn        paintEvent
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalView::paintEvent(QPaintEvent *e) {
+        KGL_TRACE_SPAN("paint");
+        QElapsedTimer clock;
+        clock.start();
+
+        QPainter p(viewport());
+        p.fillRect(e->rect(), m_Design.backColor());
+        p.setFont(m_Design.font());
+        if (!m_Source) {
+            return;
+        }
+
+        // Determines the rows that need to be repainted
+        qint64 count = m_Source->lineCount();
+        qint64 first = verticalScrollBar()->value();
+        int top = e->rect().top() / m_CellHeight;
+        int bottom = e->rect().bottom() / m_CellHeight;
+        int left = -horizontalScrollBar()->value();
+
+        for (int row = top; row <= bottom && first + row < count; ++row) {
+            const QTerminalLineSource::Line &line = m_Source->line(first + row);
+            int y = row * m_CellHeight;
+
+            // Paints the runs without copying their text
+            for (const QTerminalLineSource::Run &run : line.runs) {
+                QString text = QString::fromRawData(line.text.constData() + run.start, run.length);
+                paintText(p, left + run.start * m_CellWidth, y, text, run.style);
+            }
+
+            // The input line continues the last line of the buffer
+            if (m_Buffer && m_Buffer->isReadingInput() && first + row == count - 1) {
+                int x = left + line.text.size() * m_CellWidth;
+                quint16 style = m_Buffer->inputStyle();
+                paintText(p, x, y, m_Buffer->input(), style);
+                if (hasFocus()) {
+                    p.fillRect(x + m_Buffer->inputCaret() * m_CellWidth, y, 2, m_CellHeight, foreground(style));
+                }
+            }
+        }
+
+        // Tints the visible matches of the search
+        if (m_Search) {
+            qint64 base = m_Source->evictedLines() + first;
+            for (const QTerminalSearch::Match &match : m_Search->matches(base + top, base + bottom)) {
+                bool isCurrent = m_HasMatch && match.line == m_Match.line && match.start == m_Match.start;
+                p.fillRect(left + match.start * m_CellWidth, static_cast<int>(match.line - base) * m_CellHeight,
+                        match.length * m_CellWidth, m_CellHeight,
+                        isCurrent ? QColor(255, 140, 0, 160) : QColor(255, 215, 0, 90));
+            }
+        }
+
+        if (m_Stats) {
+            m_Stats->addPaintTime(clock.nsecsElapsed());
+        }
+    }
+
+    ///
+    ///  @fn        resizeEvent
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalView::resizeEvent(QResizeEvent *e) {
+        QScrollBar *bar = verticalScrollBar();
+        bool isAtBottom = bar->value() >= bar->maximum();
+
+        QAbstractScrollArea::resizeEvent(e);
+        updateScrollBars();
+        if (isAtBottom && m_FollowOutput) {
+            scrollToBottom();
+        }
+    }
+
+    ///
+    ///  @fn        keyPressEvent
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalView::keyPressEvent(QKeyEvent *e) {
+        if (!m_Buffer || !m_Buffer->isReadingInput()) {
+            QAbstractScrollArea::keyPressEvent(e);
+            return;
+        }
+
+        switch (e->key()) {
+        case Qt::Key_Return:
+            emit returnPressed();
+            return;
+        case Qt::Key_Backspace:
+            m_Buffer->removeInput(-1);
+            break;
+        case Qt::Key_Delete:
+            m_Buffer->removeInput(1);
+            break;
+        case Qt::Key_Left:
+            m_Buffer->setInputCaret(m_Buffer->inputCaret() - 1);
+            break;
+        case Qt::Key_Right:
+            m_Buffer->setInputCaret(m_Buffer->inputCaret() + 1);
+            break;
+        case Qt::Key_Home:
+            m_Buffer->setInputCaret(0);
+            break;
+        case Qt::Key_End:
+            m_Buffer->setInputCaret(m_Buffer->input().size());
+            break;
+        default:
+            if (e->matches(QKeySequence::Paste)) {
+                // Line breaks become blanks so that one read receives a whole block
+                QString text = QApplication::clipboard()->text();
+                for (QChar &c : text) {
+                    if (c == QLatin1Char('\n') || c == QLatin1Char('\r') || c == QLatin1Char('\t'))
+                        c = QLatin1Char(' ');
+                }
+                m_Buffer->insertInput(text);
+            } else if (!e->text().isEmpty() && e->text().at(0).isPrint()) {
+                m_Buffer->insertInput(e->text());
+            } else {
+                QAbstractScrollArea::keyPressEvent(e);
+                return;
+            }
+            break;
+        }
+
+        updateScrollBars();
+        scrollToBottom();
+        viewport()->update();
+        emit inputEdited();
+    }
+
+    ///
+    ///  @fn        scrollContentsBy
+    ///  @author    Nicolas Kogler
+    ///  @date      October 18th, 2026
+    ///
+    void QTerminalView::scrollContentsBy(int dx, int dy) {
+        Q_UNUSED(dx);
+        Q_UNUSED(dy);
+        viewport()->update();
+    }
+}
@@ -0,0 +1,544 @@
+//
+//  QTerminal - Cross platform terminal with extended functionality.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of QTerminal.
+//
+//  QTerminal is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with QTerminal.  If not, see <http://www.gnu.org/licenses/>.
+//
+//
+
+
+//
+//  Included headers
+//
+#include <KGL/Core/QNumberParser.hpp>
+#include <KGL/Core/QTerminalBuffer.hpp>
+#include <KGL/Core/QUtf8Decoder.hpp>
+#include <KGL/Dialogs/QTerminal.hpp>
+#include <QApplication>
+#include <QtTest>
+#include <climits>
+
+
+///
+///  Unit tests for the headless terminal model and the parsers it is
+///  fed by, and for the output path of QTerminal. Runs headless on the
+///  'offscreen' platform unless QT_QPA_PLATFORM is set.
+///
+Q_DECLARE_METATYPE(kgl::RenderBackend)
+
+namespace
+{
+    ///
+    ///  @fn      heldBytesOf
+    ///  @brief   Sums up the memory of the lines like the buffer does.
+    ///  @param   buffer Buffer to measure
+    ///  @returns the bytes held by text and runs of all lines.
+    ///
+    qint64 heldBytesOf(const kgl::QTerminalBuffer &buffer) {
+        qint64 bytes = 0;
+        for (qint64 i = 0; i < buffer.lineCount(); i++) {
+            const kgl::QTerminalBuffer::Line &line = buffer.line(i);
+            bytes += sizeof(kgl::QTerminalBuffer::Line);
+            bytes += line.text.size() * static_cast<qint64>(sizeof(QChar));
+            bytes += line.runs.size() * static_cast<qint64>(sizeof(kgl::QTerminalBuffer::Run));
+        }
+
+        return bytes;
+    }
+
+    ///
+    ///  @fn      compareRun
+    ///  @brief   Determines whether a run covers the given range and style.
+    ///  @returns true if all three match.
+    ///
+    bool compareRun(const kgl::QTerminalBuffer::Run &run, qint32 start, qint32 length, quint16 style) {
+        return run.start == start && run.length == length && run.style == style;
+    }
+}
+
+
+class QTerminalTests : public QObject {
+    Q_OBJECT
+private slots:
+
+    void trimLines();
+    void trimBytes();
+    void trimKeepsOpenLine();
+    void evictedLines();
+    void maximumLength();
+    void mergeRuns();
+    void insertInput();
+    void removeInput();
+    void setInputCaret();
+    void commitInput();
+    void parseNumber_data();
+    void parseNumber();
+    void decodeUtf8();
+    void highlightAcrossFlushes_data();
+    void highlightAcrossFlushes();
+    void highlightLineStart_data();
+    void highlightLineStart();
+    void switchBackend();
+};
+
+
+///
+///  @fn        trimLines
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalTests::trimLines() {
+    kgl::QTerminalBuffer buffer;
+    buffer.setMaximumLines(3);
+    buffer.append(QStringLiteral("a\nb\nc\nd\ne"), 0);
+
+    QCOMPARE(buffer.lineCount(), qint64(3));
+    QCOMPARE(buffer.line(0).text, QStringLiteral("c"));
+    QCOMPARE(buffer.line(2).text, QStringLiteral("e"));
+    QCOMPARE(buffer.heldBytes(), heldBytesOf(buffer));
+
+    // Lowering the limit trims right away
+    buffer.setMaximumLines(1);
+    QCOMPARE(buffer.lineCount(), qint64(1));
+    QCOMPARE(buffer.line(0).text, QStringLiteral("e"));
+}
+
+///
+///  @fn        trimBytes
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalTests::trimBytes() {
+    kgl::QTerminalBuffer buffer;
+    buffer.setMaximumBytes(4096);
+    for (int i = 0; i < 1000; i++) {
+        buffer.append(QStringLiteral("line %1\n").arg(i), 0);
+        QVERIFY(buffer.heldBytes() <= buffer.maximumBytes());
+    }
+
+    QVERIFY(buffer.lineCount() < 1000);
+    QCOMPARE(buffer.lineCount() + buffer.evictedLines(), qint64(1001));
+    QCOMPARE(buffer.line(buffer.lineCount() - 2).text, QStringLiteral("line 999"));
+    QCOMPARE(buffer.heldBytes(), heldBytesOf(buffer));
+}
+
+///
+///  @fn        trimKeepsOpenLine
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalTests::trimKeepsOpenLine() {
+    kgl::QTerminalBuffer buffer;
+    buffer.setMaximumLines(1);
+    buffer.append(QStringLiteral("done\nopen"), 0);
+    QCOMPARE(buffer.lineCount(), qint64(1));
+    QCOMPARE(buffer.line(0).text, QStringLiteral("open"));
+
+    // The line being written is kept even if it alone exceeds the limit
+    buffer.setMaximumBytes(1);
+    buffer.append(QString(100, QLatin1Char('x')), 0);
+    QCOMPARE(buffer.lineCount(), qint64(1));
+    QCOMPARE(buffer.line(0).text.size(), 104);
+    QCOMPARE(buffer.evictedLines(), qint64(1));
+}
+
+///
+///  @fn        evictedLines
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalTests::evictedLines() {
+    kgl::QTerminalBuffer buffer;
+    buffer.append(QStringLiteral("1\n2\n3\n4\n5\n"), 0);
+    QCOMPARE(buffer.evictedLines(), qint64(0));
+
+    buffer.setMaximumLines(4);
+    QCOMPARE(buffer.evictedLines(), qint64(2));
+    QCOMPARE(buffer.line(0).text, QStringLiteral("3"));
+
+    // Counts across appends and is not reset by clear()
+    buffer.append(QStringLiteral("6\n7\n"), 0);
+    QCOMPARE(buffer.evictedLines(), qint64(4));
+    buffer.clear();
+    QCOMPARE(buffer.evictedLines(), qint64(4));
+    QCOMPARE(buffer.lineCount(), qint64(1));
+
+    // Lifting the limit stops the eviction
+    buffer.setMaximumLines(0);
+    buffer.append(QStringLiteral("8\n9\n10\n11\n12\n"), 0);
+    QCOMPARE(buffer.evictedLines(), qint64(4));
+    QCOMPARE(buffer.lineCount(), qint64(6));
+}
+
+///
+///  @fn        maximumLength
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalTests::maximumLength() {
+    kgl::QTerminalBuffer buffer;
+    buffer.setMaximumLines(3);
+    buffer.append(QStringLiteral("a long line\nmiddle\nab"), 0);
+    QCOMPARE(buffer.maximumLength(), 11);
+
+    // Drops below the length of the evicted line
+    buffer.append(QStringLiteral("\n"), 0);
+    QCOMPARE(buffer.maximumLength(), 6);
+    buffer.append(QStringLiteral("\n\n"), 0);
+    QCOMPARE(buffer.maximumLength(), 0);
+
+    buffer.append(QStringLiteral("xyz"), 0);
+    QCOMPARE(buffer.maximumLength(), 3);
+}
+
+///
+///  @fn        mergeRuns
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalTests::mergeRuns() {
+    kgl::QTerminalBuffer buffer;
+    buffer.append(QStringLiteral("ab"), 1);
+    buffer.append(QStringLiteral("cd"), 1);
+    buffer.append(QString(), 3);
+    buffer.append(QStringLiteral("ef"), 2);
+    buffer.append(QStringLiteral("\ngh"), 2);
+
+    const kgl::QTerminalBuffer::Line &first = buffer.line(0);
+    QCOMPARE(first.text, QStringLiteral("abcdef"));
+    QCOMPARE(first.runs.size(), 2);
+    QVERIFY(compareRun(first.runs.at(0), 0, 4, 1));
+    QVERIFY(compareRun(first.runs.at(1), 4, 2, 2));
+
+    // A new line starts with a run of its own
+    const kgl::QTerminalBuffer::Line &second = buffer.line(1);
+    QCOMPARE(second.runs.size(), 1);
+    QVERIFY(compareRun(second.runs.at(0), 0, 2, 2));
+
+    buffer.append(QStringLiteral("\n"), 4);
+    QVERIFY(buffer.line(2).runs.isEmpty());
+    QCOMPARE(buffer.heldBytes(), heldBytesOf(buffer));
+}
+
+///
+///  @fn        insertInput
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalTests::insertInput() {
+    kgl::QTerminalBuffer buffer;
+    buffer.insertInput(QStringLiteral("ignored"));
+    QVERIFY(!buffer.isReadingInput());
+    QVERIFY(buffer.input().isEmpty());
+
+    buffer.beginInput(5);
+    buffer.insertInput(QStringLiteral("world"));
+    QCOMPARE(buffer.inputCaret(), 5);
+
+    buffer.setInputCaret(0);
+    buffer.insertInput(QStringLiteral("hello "));
+    QCOMPARE(buffer.input(), QStringLiteral("hello world"));
+    QCOMPARE(buffer.inputCaret(), 6);
+
+    buffer.setInputCaret(11);
+    buffer.insertInput(QStringLiteral("!"));
+    QCOMPARE(buffer.input(), QStringLiteral("hello world!"));
+    QCOMPARE(buffer.inputCaret(), 12);
+}
+
+///
+///  @fn        removeInput
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalTests::removeInput() {
+    kgl::QTerminalBuffer buffer;
+    buffer.beginInput(5);
+    buffer.insertInput(QStringLiteral("hello world"));
+
+    // Nothing follows the caret at the end
+    buffer.removeInput(5);
+    QCOMPARE(buffer.input(), QStringLiteral("hello world"));
+
+    buffer.removeInput(-6);
+    QCOMPARE(buffer.input(), QStringLiteral("hello"));
+    QCOMPARE(buffer.inputCaret(), 5);
+
+    // Nothing precedes the caret at the start
+    buffer.setInputCaret(0);
+    buffer.removeInput(-1);
+    QCOMPARE(buffer.input(), QStringLiteral("hello"));
+    QCOMPARE(buffer.inputCaret(), 0);
+
+    // Counts beyond either end are clamped
+    buffer.setInputCaret(2);
+    buffer.removeInput(-100);
+    QCOMPARE(buffer.input(), QStringLiteral("llo"));
+    QCOMPARE(buffer.inputCaret(), 0);
+    buffer.removeInput(100);
+    QVERIFY(buffer.input().isEmpty());
+    QCOMPARE(buffer.inputCaret(), 0);
+}
+
+///
+///  @fn        setInputCaret
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalTests::setInputCaret() {
+    kgl::QTerminalBuffer buffer;
+    buffer.beginInput(5);
+    buffer.setInputCaret(3);
+    QCOMPARE(buffer.inputCaret(), 0);
+
+    buffer.insertInput(QStringLiteral("abc"));
+    buffer.setInputCaret(-1);
+    QCOMPARE(buffer.inputCaret(), 0);
+    buffer.setInputCaret(4);
+    QCOMPARE(buffer.inputCaret(), 3);
+    buffer.setInputCaret(1);
+    QCOMPARE(buffer.inputCaret(), 1);
+
+    // A new input line starts at its beginning
+    buffer.endInput();
+    buffer.beginInput(5);
+    QCOMPARE(buffer.inputCaret(), 0);
+}
+
+///
+///  @fn        commitInput
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalTests::commitInput() {
+    kgl::QTerminalBuffer buffer;
+    buffer.append(QStringLiteral("prompt> "), 0);
+    buffer.beginInput(7);
+    buffer.insertInput(QStringLiteral("ls"));
+
+    QCOMPARE(buffer.commitInput(), QStringLiteral("ls"));
+    QVERIFY(!buffer.isReadingInput());
+    QVERIFY(buffer.input().isEmpty());
+    QCOMPARE(buffer.inputCaret(), 0);
+
+    // The line continues the output in the input style
+    QCOMPARE(buffer.lineCount(), qint64(2));
+    const kgl::QTerminalBuffer::Line &line = buffer.line(0);
+    QCOMPARE(line.text, QStringLiteral("prompt> ls"));
+    QCOMPARE(line.runs.size(), 2);
+    QVERIFY(compareRun(line.runs.at(0), 0, 8, 0));
+    QVERIFY(compareRun(line.runs.at(1), 8, 2, 7));
+    QVERIFY(buffer.line(1).text.isEmpty());
+
+    // An empty input still ends the line
+    buffer.beginInput(7);
+    QVERIFY(buffer.commitInput().isEmpty());
+    QCOMPARE(buffer.lineCount(), qint64(3));
+}
+
+///
+///  @fn        parseNumber_data
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalTests::parseNumber_data() {
+    QTest::addColumn<QString>("text");
+    QTest::addColumn<int>("status");
+    QTest::addColumn<qint32>("value");
+
+    const int ok = static_cast<int>(kgl::QNumberParser::Status::Ok);
+    const int invalid = static_cast<int>(kgl::QNumberParser::Status::Invalid);
+    const int overflow = static_cast<int>(kgl::QNumberParser::Status::Overflow);
+
+    QTest::newRow("decimal") << QStringLiteral("42") << ok << 42;
+    QTest::newRow("blanks") << QStringLiteral("  -7\t") << ok << -7;
+    QTest::newRow("hexadecimal") << QStringLiteral("0x1F") << ok << 31;
+    QTest::newRow("dollar") << QStringLiteral("$ff") << ok << 255;
+    QTest::newRow("octal") << QStringLiteral("0o17") << ok << 15;
+    QTest::newRow("binary") << QStringLiteral("0b101") << ok << 5;
+    QTest::newRow("separators") << QStringLiteral("1_000'000") << ok << 1000000;
+    QTest::newRow("minimum") << QStringLiteral("-2147483648") << ok << INT_MIN;
+    QTest::newRow("overflow") << QStringLiteral("2147483648") << overflow << INT_MIN;
+    QTest::newRow("empty") << QString() << invalid << 0;
+    QTest::newRow("trailing") << QStringLiteral("12a") << invalid << 0;
+    QTest::newRow("separator") << QStringLiteral("1__0") << invalid << 0;
+}
+
+///
+///  @fn        parseNumber
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalTests::parseNumber() {
+    QFETCH(QString, text);
+    QFETCH(int, status);
+    QFETCH(qint32, value);
+
+    qint32 result = -1;
+    kgl::QNumberParser::Status actual =
+        kgl::QNumberParser::parse(text.constData(), text.size(), kgl::NumberFormat::Decimal, result);
+    QCOMPARE(static_cast<int>(actual), status);
+    QCOMPARE(result, value);
+}
+
+///
+///  @fn        decodeUtf8
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalTests::decodeUtf8() {
+    kgl::QUtf8Decoder decoder;
+    QString out;
+
+    // A sequence split across two chunks
+    decoder.decode("caf\xC3", 4, out);
+    QVERIFY(decoder.hasPendingBytes());
+    QCOMPARE(out, QStringLiteral("caf"));
+    decoder.decode("\xA9!", 2, out);
+    QVERIFY(!decoder.hasPendingBytes());
+    QCOMPARE(out, QString::fromUtf8("caf\xC3\xA9!"));
+
+    // Invalid bytes and surrogates decode to U+FFFD
+    out.clear();
+    decoder.decode("a\xFF" "b\xED\xA0\x80", 6, out);
+    QCOMPARE(out.size(), 4);
+    QCOMPARE(out.at(0), QChar(QLatin1Char('a')));
+    QCOMPARE(out.at(1), QChar(QChar::ReplacementCharacter));
+    QCOMPARE(out.at(2), QChar(QLatin1Char('b')));
+    QCOMPARE(out.at(3), QChar(QChar::ReplacementCharacter));
+}
+
+///
+///  @fn        highlightAcrossFlushes_data
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalTests::highlightAcrossFlushes_data() {
+    QTest::addColumn<kgl::RenderBackend>("backend");
+    QTest::newRow("document") << kgl::RenderBackend::Document;
+    QTest::newRow("grid") << kgl::RenderBackend::Grid;
+}
+
+///
+///  @fn        highlightAcrossFlushes
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalTests::highlightAcrossFlushes() {
+    QFETCH(kgl::RenderBackend, backend);
+
+    kgl::QTerminal terminal(NULL);
+    terminal.setRenderBackend(backend);
+    QVERIFY(terminal.addHighlightRule(QStringLiteral("ERROR"), kgl::TextState::Error) >= 0);
+
+    // The match is split by a flush, as output of a child often is
+    terminal.writeString(QStringLiteral("an ERR"));
+    terminal.flush();
+    terminal.writeString(QStringLiteral("OR here\n"));
+    terminal.flush();
+
+    const quint16 normal = kgl::QTerminalBuffer::styleOf(kgl::TextState::Normal);
+    const quint16 error = kgl::QTerminalBuffer::styleOf(kgl::TextState::Error);
+    const kgl::QTerminalBuffer::Line &line = terminal.buffer().line(0);
+    QCOMPARE(line.text, QStringLiteral("an ERROR here"));
+    QCOMPARE(line.runs.size(), 3);
+    QVERIFY(compareRun(line.runs.at(0), 0, 3, normal));
+    QVERIFY(compareRun(line.runs.at(1), 3, 5, error));
+    QVERIFY(compareRun(line.runs.at(2), 8, 5, normal));
+}
+
+///
+///  @fn        highlightLineStart_data
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalTests::highlightLineStart_data() {
+    highlightAcrossFlushes_data();
+}
+
+///
+///  @fn        highlightLineStart
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalTests::highlightLineStart() {
+    QFETCH(kgl::RenderBackend, backend);
+
+    kgl::QTerminal terminal(NULL);
+    terminal.setRenderBackend(backend);
+    QVERIFY(terminal.addHighlightRule(QStringLiteral("^ERROR"), kgl::TextState::Warning,
+                                      kgl::PatternSyntax::RegularExpression) >= 0);
+
+    // '^' matches where a line starts, not where a batch starts
+    terminal.writeString(QStringLiteral("x ERR"));
+    terminal.flush();
+    terminal.writeString(QStringLiteral("OR\nERR"));
+    terminal.flush();
+    terminal.writeString(QStringLiteral("OR\n"));
+    terminal.flush();
+
+    const quint16 warning = kgl::QTerminalBuffer::styleOf(kgl::TextState::Warning);
+    const kgl::QTerminalBuffer &buffer = terminal.buffer();
+    QCOMPARE(buffer.line(0).runs.size(), 1);
+    QVERIFY(buffer.line(0).runs.at(0).style != warning);
+    QCOMPARE(buffer.line(1).text, QStringLiteral("ERROR"));
+    QCOMPARE(buffer.line(1).runs.size(), 1);
+    QVERIFY(compareRun(buffer.line(1).runs.at(0), 0, 5, warning));
+}
+
+///
+///  @fn        switchBackend
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+void QTerminalTests::switchBackend() {
+    kgl::QTerminal terminal(NULL);
+    terminal.writeString(QStringLiteral("one\n"));
+    terminal.flush();
+
+    // Output written in either backend survives the switches
+    terminal.setRenderBackend(kgl::RenderBackend::Grid);
+    terminal.writeString(QStringLiteral("two\n"));
+    terminal.flush();
+    terminal.setRenderBackend(kgl::RenderBackend::Document);
+
+    const kgl::QTerminalBuffer &buffer = terminal.buffer();
+    QCOMPARE(buffer.lineCount(), Q_INT64_C(3));
+    QCOMPARE(buffer.line(0).text, QStringLiteral("one"));
+    QCOMPARE(buffer.line(1).text, QStringLiteral("two"));
+
+    // The rebuilt document holds "one\ntwo\n" in three blocks
+    QCOMPARE(terminal.heldBytes() - buffer.heldBytes(), Q_INT64_C(9 * 2 + 3 * 256));
+}
+
+
+///
+///  @fn        main
+///  @author    Nicolas Kogler
+///  @date      October 18th, 2026
+///
+int main(int argc, char *argv[]) {
+    // Runs without a display unless a platform was asked for
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    QApplication app(argc, argv);
+    QTerminalTests tests;
+    return QTest::qExec(&tests, argc, argv);
+}
+
+#include "QTerminalTests.moc"
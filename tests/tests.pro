@@ -0,0 +1,11 @@
+QT += core gui widgets uitools testlib
+CONFIG += c++14 console testcase
+CONFIG -= app_bundle
+DEFINES += KGL_STATIC
+TARGET = QTerminalTests
+TEMPLATE = app
+
+include(../QTerminal.pri)
+
+SOURCES += \
+    QTerminalTests.cpp